@@ -3,10 +3,123 @@
 #include "Bindings/ScriptablePropertyBindings.h"
 #include "PropertyBindingDataView.h"
 #include "ScriptableObject.h"
+#include "ScriptableContainer.h"
+#include <atomic>
+
+namespace ScriptablePropertyBindings
+{
+	/** Per-thread state of FScriptableSharedBindingsScope. */
+	struct FSharedBindingsTable
+	{
+		int32 ScopeCount = 0;
+
+		/** Lists handed out by templates during the current duplication. Duplicates find theirs by index. */
+		TArray<TSharedPtr<const FScriptableSharedBindings, ESPMode::ThreadSafe>> Entries;
+	};
+
+	static thread_local FSharedBindingsTable SharedBindingsTable;
+
+	/** Process-wide, so lists of different objects never share a revision. */
+	static std::atomic<uint32> RevisionCounter = 0;
+
+	static uint32 NextRevision()
+	{
+		return ++RevisionCounter;
+	}
+
+	/** True if Ar is a duplication that shares binding lists instead of copying them. */
+	static bool SharesBindings(const FArchive& Ar)
+	{
+		return Ar.HasAnyPortFlags(PPF_Duplicate) && FScriptableSharedBindingsScope::IsActive();
+	}
+}
+
+FScriptableSharedBindingsScope::FScriptableSharedBindingsScope()
+{
+	++ScriptablePropertyBindings::SharedBindingsTable.ScopeCount;
+}
+
+FScriptableSharedBindingsScope::~FScriptableSharedBindingsScope()
+{
+	ScriptablePropertyBindings::FSharedBindingsTable& Table = ScriptablePropertyBindings::SharedBindingsTable;
+	if (--Table.ScopeCount == 0)
+	{
+		Table.Entries.Reset();
+	}
+}
+
+bool FScriptableSharedBindingsScope::IsActive()
+{
+	return ScriptablePropertyBindings::SharedBindingsTable.ScopeCount > 0;
+}
+
+bool FScriptablePropertyBindings::Serialize(FArchive& Ar)
+{
+	if (!ScriptablePropertyBindings::SharesBindings(Ar))
+	{
+		// Regular tagged serialization.
+		return false;
+	}
+
+	// The template registers its list in the scope's table and writes the slot; the duplicate reads it back.
+	ScriptablePropertyBindings::FSharedBindingsTable& Table = ScriptablePropertyBindings::SharedBindingsTable;
+	int32 TableIndex = INDEX_NONE;
+
+	if (Ar.IsSaving())
+	{
+		if (!SharedBindings.IsValid())
+		{
+			TSharedRef<FScriptableSharedBindings, ESPMode::ThreadSafe> NewShared = MakeShared<FScriptableSharedBindings, ESPMode::ThreadSafe>();
+			NewShared->Bindings = Bindings;
+			SharedBindings = NewShared;
+		}
+
+		TableIndex = Table.Entries.Find(SharedBindings);
+		if (TableIndex == INDEX_NONE)
+		{
+			TableIndex = Table.Entries.Add(SharedBindings);
+		}
+
+		Ar << TableIndex;
+	}
+	else if (Ar.IsLoading())
+	{
+		Ar << TableIndex;
+
+		if (!Table.Entries.IsValidIndex(TableIndex))
+		{
+			Ar.SetError();
+			return true;
+		}
+
+		SharedBindings = Table.Entries[TableIndex];
+		Bindings.Reset();
+		Revision = ScriptablePropertyBindings::NextRevision();
+	}
+
+	return true;
+}
+
+void FScriptablePropertyBindings::OnBindingsChanged()
+{
+	SharedBindings.Reset();
+	Revision = ScriptablePropertyBindings::NextRevision();
+}
+
+void FScriptablePropertyBindings::PostSerialize(const FArchive& Ar)
+{
+	// Anything else that loads Bindings (undo/redo, a tagged reload, a regular copy) invalidates the list handed to duplicates.
+	if (Ar.IsLoading() && !ScriptablePropertyBindings::SharesBindings(Ar))
+	{
+		OnBindingsChanged();
+	}
+}
 
 #if WITH_EDITOR
 void FScriptablePropertyBindings::AddPropertyBinding(const FPropertyBindingPath& SourcePath, const FPropertyBindingPath& TargetPath)
 {
+	OnBindingsChanged();
+
 	// If a binding already exists for this target, update it
 	for (FScriptablePropertyBinding& Binding : Bindings)
 	{
@@ -27,6 +140,8 @@ void FScriptablePropertyBindings::AddPropertyBinding(const FPropertyBindingPath&
 
 void FScriptablePropertyBindings::RemovePropertyBindings(const FPropertyBindingPath& TargetPath)
 {
+	OnBindingsChanged();
+
 	Bindings.RemoveAll([&TargetPath](const FScriptablePropertyBinding& Binding)
 	{
 		return Binding.TargetPath == TargetPath;
@@ -35,7 +150,7 @@ void FScriptablePropertyBindings::RemovePropertyBindings(const FPropertyBindingP
 
 bool FScriptablePropertyBindings::HasPropertyBinding(const FPropertyBindingPath& TargetPath) const
 {
-	return Bindings.ContainsByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
+	return GetBindings().ContainsByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
 	{
 		return Binding.TargetPath == TargetPath;
 	});
@@ -45,6 +160,8 @@ void FScriptablePropertyBindings::HandleArrayElementRemoved(const FName& ArrayNa
 {
 	if (IndexRemoved < 0) return;
 
+	OnBindingsChanged();
+
 	// Iterate backwards to safely remove elements while iterating
 	for (int32 i = Bindings.Num() - 1; i >= 0; --i)
 	{
@@ -79,6 +196,8 @@ void FScriptablePropertyBindings::HandleArrayElementRemoved(const FName& ArrayNa
 
 void FScriptablePropertyBindings::HandleArrayClear(const FName& ArrayName)
 {
+	OnBindingsChanged();
+
 	Bindings.RemoveAll([&ArrayName](const FScriptablePropertyBinding& Binding)
 	{
 		if (Binding.TargetPath.NumSegments() > 0)
@@ -90,9 +209,25 @@ void FScriptablePropertyBindings::HandleArrayClear(const FName& ArrayName)
 	});
 }
 
+void FScriptablePropertyBindings::HandlePropertyMoved(const FName& PropertyName, const FName& NewParentName)
+{
+	for (FScriptablePropertyBinding& Binding : Bindings)
+	{
+		if (Binding.TargetPath.NumSegments() > 0 && Binding.TargetPath.GetSegment(0).GetName() == PropertyName)
+		{
+			OnBindingsChanged();
+
+			TArray<FPropertyBindingPathSegment> Segments;
+			Segments.Emplace(NewParentName);
+			Segments.Append(Binding.TargetPath.GetSegments());
+			Binding.TargetPath = FPropertyBindingPath(Binding.TargetPath.GetStructID(), Segments);
+		}
+	}
+}
+
 const FPropertyBindingPath* FScriptablePropertyBindings::GetPropertyBinding(const FPropertyBindingPath& TargetPath) const
 {
-	const FScriptablePropertyBinding* FoundBinding = Bindings.FindByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
+	const FScriptablePropertyBinding* FoundBinding = GetBindings().FindByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
 	{
 		return Binding.TargetPath == TargetPath;
 	});
@@ -101,34 +236,84 @@ const FPropertyBindingPath* FScriptablePropertyBindings::GetPropertyBinding(cons
 }
 #endif
 
-void FScriptablePropertyBindings::ResolveBindings(UScriptableObject* TargetObject)
+void FScriptablePropertyBindings::ResolveBindings(UScriptableObject* TargetObject, FScriptableBindingCache* Cache)
 {
 	if (!TargetObject) return;
 
-	// Prepare the Context View in advance (it might be used by multiple bindings)
-	const FInstancedPropertyBag* Context = TargetObject->GetContext();
+	// The Target View is always the object requesting the resolution
+	ResolveBindings(GetBindings(), FPropertyBindingDataView(TargetObject), TargetObject->GetContextScope(), TargetObject->GetBindingSourceMap(), Cache);
+}
 
-	// Prepare Context View
-	FPropertyBindingDataView ContextView;
-	if (Context && Context->IsValid())
+namespace ScriptablePropertyBindings
+{
+	/** True if the path is a single property, read without array or struct indirection. */
+	static bool IsPlainProperty(const FPropertyBindingPath& Path)
 	{
-		ContextView = FPropertyBindingDataView(Context->GetPropertyBagStruct(), const_cast<FInstancedPropertyBag*>(Context)->GetMutableValue().GetMemory());
+		return Path.NumSegments() == 1 && Path.GetSegment(0).GetArrayIndex() == INDEX_NONE && Path.GetSegment(0).GetInstanceStruct() == nullptr;
 	}
+}
 
-	// The Target View is always the object requesting the resolution
-	FPropertyBindingDataView TargetView(TargetObject);
+void FScriptablePropertyBindings::BuildCache(FScriptableBindingCache& Cache, TConstArrayView<FScriptablePropertyBinding> InBindings, const UStruct* TargetLayout, const FScriptableContextScope* InContext)
+{
+	Cache.Entries.Reset(InBindings.Num());
+	Cache.Bindings = InBindings.GetData();
+	Cache.TargetLayout = TargetLayout;
+	Cache.Context = InContext;
+
+	if (InContext)
+	{
+		InContext->GetChainLayouts(Cache.ContextLayouts);
+	}
+	else
+	{
+		Cache.ContextLayouts.Reset();
+	}
 
-	for (const FScriptablePropertyBinding& Binding : Bindings)
+	for (const FScriptablePropertyBinding& Binding : InBindings)
 	{
+		FScriptableBindingCache::FEntry& Entry = Cache.Entries.AddDefaulted_GetRef();
+
+		// Sibling sources are looked up in the binding map on every call, the map can change between registrations.
+		if (Binding.SourceID.IsValid() || !InContext || Binding.SourcePath.NumSegments() == 0)
+		{
+			continue;
+		}
+
+		const FProperty* SourceProperty = nullptr;
+		Entry.Source = InContext->FindLayerWithProperty(Binding.SourcePath.GetSegment(0).GetName(), &SourceProperty);
+
+		if (Entry.Source.IsSet() && TargetLayout && ScriptablePropertyBindings::IsPlainProperty(Binding.SourcePath) && ScriptablePropertyBindings::IsPlainProperty(Binding.TargetPath))
+		{
+			Entry.SourceProperty = SourceProperty;
+			Entry.TargetProperty = TargetLayout->FindPropertyByName(Binding.TargetPath.GetSegment(0).GetName());
+		}
+	}
+}
+
+void FScriptablePropertyBindings::ResolveBindings(TConstArrayView<FScriptablePropertyBinding> InBindings, const FPropertyBindingDataView& TargetView, const FScriptableContextScope* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, FScriptableBindingCache* Cache)
+{
+	if (InBindings.IsEmpty()) return;
+
+	if (Cache && (Cache->Entries.Num() != InBindings.Num() || Cache->Bindings != InBindings.GetData() || Cache->TargetLayout != TargetView.GetStruct()
+		|| Cache->Context != InContext || (InContext && !InContext->HasChainLayouts(Cache->ContextLayouts))))
+	{
+		BuildCache(*Cache, InBindings, TargetView.GetStruct(), InContext);
+	}
+
+	for (int32 Index = 0; Index < InBindings.Num(); ++Index)
+	{
+		const FScriptablePropertyBinding& Binding = InBindings[Index];
+
 		// Determine the Source Data View (Who are we copying FROM?)
 		FPropertyBindingDataView SourceView;
 		if (Binding.SourceID.IsValid())
 		{
 			// CASE A: Sibling Binding
-			// Direct lookup via the injected map in TargetObject
-			if (UScriptableObject* SourceObj = TargetObject->FindBindingSource(Binding.SourceID))
+			// Direct lookup via the injected map
+			const TObjectPtr<UScriptableObject>* SourceObj = InBindingMap ? InBindingMap->Find(Binding.SourceID) : nullptr;
+			if (SourceObj && *SourceObj)
 			{
-				SourceView = FPropertyBindingDataView(SourceObj);
+				SourceView = FPropertyBindingDataView(SourceObj->Get());
 			}
 			else
 			{
@@ -136,10 +321,35 @@ void FScriptablePropertyBindings::ResolveBindings(UScriptableObject* TargetObjec
 				continue;
 			}
 		}
+		else if (Cache)
+		{
+			// CASE B: Context Binding, through the layer found when the cache was built.
+			const FScriptableBindingCache::FEntry& Entry = Cache->Entries[Index];
+			SourceView = FScriptableContextScope::GetLayerView(Entry.Source);
+
+			if (!SourceView.IsValid())
+			{
+				// Not declared when the cache was built, or the layer changed its layout since.
+				if (InContext && Binding.SourcePath.NumSegments() > 0)
+				{
+					SourceView = InContext->FindViewWithProperty(Binding.SourcePath.GetSegment(0).GetName());
+				}
+			}
+			else if (Entry.SourceProperty && Entry.TargetProperty)
+			{
+				CopyValue(Entry.SourceProperty, Entry.SourceProperty->ContainerPtrToValuePtr<void>(SourceView.GetMemory()),
+					Entry.TargetProperty, Entry.TargetProperty->ContainerPtrToValuePtr<void>(TargetView.GetMutableMemory()));
+				continue;
+			}
+		}
 		else
 		{
 			// CASE B: Context Binding
-			SourceView = ContextView;
+			// The first segment names the variable, the innermost layer (bag or fixed struct) declaring it is read in place.
+			if (InContext && Binding.SourcePath.NumSegments() > 0)
+			{
+				SourceView = InContext->FindViewWithProperty(Binding.SourcePath.GetSegment(0).GetName());
+			}
 		}
 
 		// Perform the Copy
@@ -161,11 +371,11 @@ void FScriptablePropertyBindings::CopySingleBinding(const FScriptablePropertyBin
 	const FPropertyBindingPathIndirection& SourceLeaf = SourceIndirections.Last();
 	const FPropertyBindingPathIndirection& TargetLeaf = TargetIndirections.Last();
 
-	const FProperty* SourceProp = SourceLeaf.GetProperty();
-	const FProperty* TargetProp = TargetLeaf.GetProperty();
-	const void* SourceAddr = SourceLeaf.GetPropertyAddress();
-	void* TargetAddr = TargetLeaf.GetMutablePropertyAddress();
+	CopyValue(SourceLeaf.GetProperty(), SourceLeaf.GetPropertyAddress(), TargetLeaf.GetProperty(), TargetLeaf.GetMutablePropertyAddress());
+}
 
+void FScriptablePropertyBindings::CopyValue(const FProperty* SourceProp, const void* SourceAddr, const FProperty* TargetProp, void* TargetAddr)
+{
 	if (SourceProp && TargetProp && SourceAddr && TargetAddr)
 	{
 		// Identical Types (Fast Copy)
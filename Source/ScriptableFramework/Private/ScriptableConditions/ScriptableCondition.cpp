@@ -1,10 +1,263 @@
 // Copyright 2025 kirzo
 
 #include "ScriptableConditions/ScriptableCondition.h"
+#include "PropertyBindingDataView.h"
+#include "Algo/Compare.h"
+
+void UScriptableCondition::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITOR
+	MigrateDeprecatedToInstanceData();
+#endif
+}
 
 bool UScriptableCondition::CheckCondition()
 {
 	ResolveBindings();
 	const bool bResult = Evaluate();
 	return IsNegated() ? !bResult : bResult;
-}
\ No newline at end of file
+}
+
+bool UScriptableCondition::CheckCondition(const FScriptableConditionInstance& Instance) const
+{
+	TGuardValue<const FScriptableConditionInstance*> InstanceGuard(ActiveInstance, &Instance);
+
+	ResolveInstanceDataBindings(Instance);
+	const bool bResult = Evaluate();
+	return IsNegated() ? !bResult : bResult;
+}
+
+void UScriptableCondition::InitInstanceData(FInstancedStruct& OutInstanceData) const
+{
+	const UScriptStruct* InstanceDataType = GetInstanceDataType();
+	if (!InstanceDataType)
+	{
+		OutInstanceData.Reset();
+		return;
+	}
+
+	if (const FStructProperty* InstanceDataProperty = FindInstanceDataProperty())
+	{
+		OutInstanceData.InitializeAs(InstanceDataType, InstanceDataProperty->ContainerPtrToValuePtr<uint8>(this));
+	}
+	else
+	{
+		OutInstanceData.InitializeAs(InstanceDataType);
+	}
+}
+
+namespace ScriptableCondition
+{
+	/** Properties that are not part of a template's identity: BindingID, runtime state, and the bindings (compared without their target ID). */
+	static bool IsIgnoredByTemplateIdentity(const FProperty* Property)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_Deprecated)
+			|| (StructProperty && StructProperty->Struct == FScriptablePropertyBindings::StaticStruct());
+	}
+
+	/** Hashes the hashable values of a struct, recursing into nested structs. Only narrows the candidates, matches are confirmed with Identical. */
+	static uint32 HashValues(const UStruct* Struct, const void* Container, uint32 Hash)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (IsIgnoredByTemplateIdentity(Property))
+			{
+				continue;
+			}
+
+			for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+			{
+				const void* Value = Property->ContainerPtrToValuePtr<void>(Container, Index);
+				if (Property->HasAllPropertyFlags(CPF_HasGetValueTypeHash))
+				{
+					Hash = HashCombineFast(Hash, Property->GetValueTypeHash(Value));
+				}
+				else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+				{
+					Hash = HashValues(StructProperty->Struct, Value, Hash);
+				}
+			}
+		}
+
+		return Hash;
+	}
+}
+
+uint32 UScriptableCondition::GetTemplateHash() const
+{
+	uint32 Hash = ScriptableCondition::HashValues(GetClass(), this, GetTypeHash(GetClass()));
+
+	for (const FScriptablePropertyBinding& Binding : PropertyBindings.GetBindings())
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Binding.SourceID));
+	}
+
+	return Hash;
+}
+
+bool UScriptableCondition::IsEquivalentTemplate(const UScriptableCondition& Other) const
+{
+	if (GetClass() != Other.GetClass())
+	{
+		return false;
+	}
+
+	// Instanced subobjects compare by pointer, which keeps their owners unique.
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (ScriptableCondition::IsIgnoredByTemplateIdentity(Property))
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+		{
+			if (!Property->Identical_InContainer(this, &Other, Index))
+			{
+				return false;
+			}
+		}
+	}
+
+	// Target paths carry the owner's BindingID, only their segments are compared.
+	const TConstArrayView<FScriptablePropertyBinding> Bindings = PropertyBindings.GetBindings();
+	const TConstArrayView<FScriptablePropertyBinding> OtherBindings = Other.PropertyBindings.GetBindings();
+	if (Bindings.Num() != OtherBindings.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+	{
+		const FScriptablePropertyBinding& Binding = Bindings[Index];
+		const FScriptablePropertyBinding& OtherBinding = OtherBindings[Index];
+
+		if (Binding.SourceID != OtherBinding.SourceID || !(Binding.SourcePath == OtherBinding.SourcePath)
+			|| !Algo::Compare(Binding.TargetPath.GetSegments(), OtherBinding.TargetPath.GetSegments()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const FStructProperty* UScriptableCondition::FindInstanceDataProperty() const
+{
+	if (!bInstanceDataPropertyCached)
+	{
+		bInstanceDataPropertyCached = true;
+
+		if (const UScriptStruct* InstanceDataType = GetInstanceDataType())
+		{
+			for (TFieldIterator<FStructProperty> It(GetClass()); It; ++It)
+			{
+				if (It->Struct == InstanceDataType)
+				{
+					CachedInstanceDataProperty = *It;
+					break;
+				}
+			}
+		}
+	}
+
+	return CachedInstanceDataProperty;
+}
+
+#if WITH_EDITOR
+bool UScriptableCondition::GetInstanceDataBindingDisplayText(FName MemberName, FString& OutText) const
+{
+	const FStructProperty* InstanceDataProperty = FindInstanceDataProperty();
+	if (!InstanceDataProperty)
+	{
+		return GetBindingDisplayText(MemberName, OutText);
+	}
+
+	FPropertyBindingPath TargetPath;
+	TargetPath.AddPathSegment(InstanceDataProperty->GetFName());
+	TargetPath.AddPathSegment(MemberName);
+	return GetBindingDisplayText(MoveTemp(TargetPath), OutText);
+}
+
+void UScriptableCondition::MigrateDeprecatedToInstanceData()
+{
+	const FStructProperty* InstanceDataProperty = FindInstanceDataProperty();
+	if (!InstanceDataProperty)
+	{
+		return;
+	}
+
+	const UObject* Defaults = GetClass()->GetDefaultObject();
+	uint8* InstanceDataMemory = InstanceDataProperty->ContainerPtrToValuePtr<uint8>(this);
+
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		FString MemberName = Property->GetName();
+		if (!MemberName.RemoveFromEnd(TEXT("_DEPRECATED")))
+		{
+			continue;
+		}
+
+		const FProperty* Member = InstanceDataProperty->Struct->FindPropertyByName(FName(MemberName));
+		if (!Member || !Member->SameType(Property))
+		{
+			continue;
+		}
+
+		// Values still at their default were never authored, or have already been moved.
+		if (!Property->Identical_InContainer(this, Defaults))
+		{
+			Member->CopyCompleteValue(Member->ContainerPtrToValuePtr<void>(InstanceDataMemory), Property->ContainerPtrToValuePtr<void>(this));
+			Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(this), Property->ContainerPtrToValuePtr<void>(Defaults));
+		}
+
+		PropertyBindings.HandlePropertyMoved(Member->GetFName(), InstanceDataProperty->GetFName());
+	}
+}
+#endif
+
+void UScriptableCondition::ResolveInstanceDataBindings(const FScriptableConditionInstance& Instance) const
+{
+	if (!Instance.InstanceData.IsValid())
+	{
+		return;
+	}
+
+	// Rebuilt whenever the authored bindings change (editor edits, undo/redo, reloads).
+	if (!bInstanceDataBindingsBuilt || InstanceDataBindingsRevision != PropertyBindings.GetRevision())
+	{
+		bInstanceDataBindingsBuilt = true;
+		InstanceDataBindingsRevision = PropertyBindings.GetRevision();
+		InstanceDataBindings.Reset();
+
+		// Rebase "InstanceData.Value" target paths onto the instance data struct ("Value").
+		// Bindings targeting the template itself would mutate shared state, so they are ignored.
+		const FStructProperty* InstanceDataProperty = FindInstanceDataProperty();
+		for (const FScriptablePropertyBinding& Binding : PropertyBindings.GetBindings())
+		{
+			const TConstArrayView<FPropertyBindingPathSegment> Segments = Binding.TargetPath.GetSegments();
+			if (InstanceDataProperty && Segments.Num() > 1 && Segments[0].GetName() == InstanceDataProperty->GetFName())
+			{
+				FScriptablePropertyBinding& Rebased = InstanceDataBindings.Add_GetRef(Binding);
+				Rebased.TargetPath = FPropertyBindingPath(Binding.TargetPath.GetStructID(), Segments.RightChop(1));
+			}
+			else
+			{
+				UE_LOG(LogScriptableObject, Warning, TEXT("%s: binding to '%s' is ignored, shared conditions can only bind to their instance data."), *GetPathName(), *Binding.TargetPath.ToString());
+			}
+		}
+	}
+
+	if (!InstanceDataBindings.IsEmpty())
+	{
+		const FPropertyBindingDataView TargetView(Instance.InstanceData.GetScriptStruct(), Instance.InstanceData.GetMemory());
+		FScriptablePropertyBindings::ResolveBindings(InstanceDataBindings, TargetView, Instance.Context, Instance.BindingMap, Instance.BindingCache);
+	}
+}
@@ -0,0 +1,219 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditionTemplateCache.h"
+#include "ScriptableConditions/ScriptableCondition.h"
+#include "ScriptableConditions/ScriptableRequirement.h"
+#include "ScriptableFramework.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/PropertyBag.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shared Condition Templates"), STAT_ScriptableConditionTemplateCache_NumTemplates, STATGROUP_ScriptableFramework);
+
+namespace ScriptableConditionTemplateCache
+{
+	static bool bDedupTemplates = true;
+	static FAutoConsoleVariableRef CVarDedupTemplates(
+		TEXT("Scriptable.Conditions.DedupTemplates"),
+		bDedupTemplates,
+		TEXT("If true, structurally identical shared condition templates are replaced with a single instance when their package is loaded."));
+
+	static FAutoConsoleCommand CmdTrim(
+		TEXT("Scriptable.Conditions.TrimTemplates"),
+		TEXT("Drops the canonical condition templates no loaded package uses anymore."),
+		FConsoleCommandDelegate::CreateStatic(&FScriptableConditionTemplateCache::Trim));
+
+	static TUniquePtr<FScriptableConditionTemplateCache> Instance;
+
+	/** True for null and for objects of asset packages, which don't tie a copy to a level or to runtime state. */
+	static bool IsAssetObject(const UObject* Object)
+	{
+		if (!Object)
+		{
+			return true;
+		}
+
+		const UPackage* Package = Object->GetPackage();
+		return Package && Package != GetTransientPackage() && !Package->ContainsMap()
+			&& !Object->HasAnyFlags(RF_Transient) && !Object->IsA<UWorld>() && !Object->IsInA(UWorld::StaticClass());
+	}
+}
+
+bool FScriptableConditionTemplateCache::IsEnabled()
+{
+	return !GIsEditor && ScriptableConditionTemplateCache::bDedupTemplates;
+}
+
+void FScriptableConditionTemplateCache::Startup()
+{
+	ScriptableConditionTemplateCache::Instance = MakeUnique<FScriptableConditionTemplateCache>();
+	ScriptableConditionTemplateCache::Instance->EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddStatic(&FScriptableConditionTemplateCache::OnEndLoadPackage);
+
+	// Packages unloaded by this collection no longer show up as users.
+	ScriptableConditionTemplateCache::Instance->PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FScriptableConditionTemplateCache::Trim);
+}
+
+void FScriptableConditionTemplateCache::Shutdown()
+{
+	if (FScriptableConditionTemplateCache* Cache = ScriptableConditionTemplateCache::Instance.Get())
+	{
+		FCoreUObjectDelegates::OnEndLoadPackage.Remove(Cache->EndLoadPackageHandle);
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(Cache->PostGarbageCollectHandle);
+		DEC_DWORD_STAT_BY(STAT_ScriptableConditionTemplateCache_NumTemplates, Cache->NumTemplates);
+	}
+
+	ScriptableConditionTemplateCache::Instance.Reset();
+}
+
+FScriptableConditionTemplateCache* FScriptableConditionTemplateCache::Get()
+{
+	check(IsInGameThread());
+	return ScriptableConditionTemplateCache::Instance.Get();
+}
+
+void FScriptableConditionTemplateCache::Trim()
+{
+	FScriptableConditionTemplateCache* Cache = Get();
+	if (!Cache)
+	{
+		return;
+	}
+
+	int32 NumRemoved = 0;
+	for (auto It = Cache->Templates.CreateIterator(); It; ++It)
+	{
+		NumRemoved += It.Value().RemoveAll([](FEntry& Entry)
+		{
+			Entry.Users.RemoveAll([](const TWeakObjectPtr<UPackage>& User) { return !User.IsValid(); });
+			return Entry.Users.IsEmpty();
+		});
+
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Dropped copies are collected by the next garbage collection, unless something outside a cluster still uses them.
+	Cache->NumTemplates -= NumRemoved;
+	DEC_DWORD_STAT_BY(STAT_ScriptableConditionTemplateCache_NumTemplates, NumRemoved);
+}
+
+void FScriptableConditionTemplateCache::OnEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+	FScriptableConditionTemplateCache* Cache = IsEnabled() ? Get() : nullptr;
+	if (!Cache)
+	{
+		return;
+	}
+
+	// Shared templates are instanced subobjects, their outers hold the requirements they were authored in.
+	TSet<UObject*> Owners;
+	for (UPackage* Package : Context.LoadedPackages)
+	{
+		ForEachObjectWithPackage(Package, [&Owners](UObject* Object)
+		{
+			const UScriptableCondition* Condition = Cast<UScriptableCondition>(Object);
+			if (Condition && Condition->IsSharedTemplate() && Condition->GetOuter())
+			{
+				Owners.Add(Condition->GetOuter());
+			}
+			return true;
+		});
+	}
+
+	for (UObject* Owner : Owners)
+	{
+		Cache->CanonicalizeRequirements(Owner);
+	}
+}
+
+bool FScriptableConditionTemplateCache::CanShare(const UScriptableCondition& Template)
+{
+	for (TPropertyValueIterator<FProperty> It(Template.GetClass(), &Template); It; ++It)
+	{
+		if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(It.Key()))
+		{
+			if (!ScriptableConditionTemplateCache::IsAssetObject(ObjectProperty->GetObjectPropertyValue(It.Value())))
+			{
+				return false;
+			}
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(It.Key()))
+		{
+			// Instanced structs hide their references from reflection, what can't be checked isn't shared.
+			if ((StructProperty->Struct == FInstancedStruct::StaticStruct() && static_cast<const FInstancedStruct*>(It.Value())->IsValid())
+				|| (StructProperty->Struct == FInstancedPropertyBag::StaticStruct() && static_cast<const FInstancedPropertyBag*>(It.Value())->IsValid()))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void FScriptableConditionTemplateCache::CanonicalizeRequirements(UObject* Owner)
+{
+	UPackage* User = Owner->GetPackage();
+
+	for (TPropertyValueIterator<FStructProperty> It(Owner->GetClass(), Owner); It; ++It)
+	{
+		const UScriptStruct* Struct = It.Key()->Struct;
+		if (!Struct || !Struct->IsChildOf(FScriptableRequirement::StaticStruct()))
+		{
+			continue;
+		}
+
+		FScriptableRequirement& Requirement = *static_cast<FScriptableRequirement*>(const_cast<void*>(It.Value()));
+		for (TObjectPtr<UScriptableCondition>& Condition : Requirement.Conditions)
+		{
+			if (Condition && Condition->IsSharedTemplate() && CanShare(*Condition))
+			{
+				Condition = Canonicalize(Condition, User);
+			}
+		}
+	}
+}
+
+UScriptableCondition* FScriptableConditionTemplateCache::Canonicalize(UScriptableCondition* Template, UPackage* User)
+{
+	TArray<FEntry>& Candidates = Templates.FindOrAdd(Template->GetTemplateHash());
+	for (FEntry& Candidate : Candidates)
+	{
+		if (Candidate.Template == Template || Candidate.Template->IsEquivalentTemplate(*Template))
+		{
+			Candidate.Users.AddUnique(User);
+			return Candidate.Template;
+		}
+	}
+
+	// A copy outside the authoring package, the authoring package can unload while other packages still use it.
+	// Canonical copies dropped by Trim but still referenced are taken back as is.
+	UScriptableCondition* Canonical = Template->bCanonicalTemplate ? Template : UScriptableObject::DuplicateForRuntime<UScriptableCondition>(Template, GetTransientPackage());
+	Canonical->bCanonicalTemplate = true;
+
+	FEntry& Entry = Candidates.AddDefaulted_GetRef();
+	Entry.Template = Canonical;
+	Entry.Users.Add(User);
+
+	++NumTemplates;
+	INC_DWORD_STAT(STAT_ScriptableConditionTemplateCache_NumTemplates);
+
+	return Canonical;
+}
+
+void FScriptableConditionTemplateCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<uint32, TArray<FEntry>>& Pair : Templates)
+	{
+		for (FEntry& Entry : Pair.Value)
+		{
+			Collector.AddReferencedObject(Entry.Template);
+		}
+	}
+}
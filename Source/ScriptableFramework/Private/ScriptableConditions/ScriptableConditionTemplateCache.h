@@ -0,0 +1,67 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UScriptableCondition;
+struct FEndLoadPackageContext;
+
+/**
+ * Hash-consing of shared condition templates.
+ * Shared templates are immutable at runtime, so templates with the same class, authored values and bindings
+ * can be replaced with a single canonical copy, whatever requirement or asset they were authored in.
+ * Done once when packages finish loading: the requirements of the loaded objects are pointed at the canonical copies.
+ * Only templates whose values reference nothing but asset objects are shared (see CanShare): a canonical copy keeps
+ * its references, and must not pin level actors or worlds.
+ * Canonical copies live in the transient package and are referenced by the cache while a package using them is loaded,
+ * so loaded objects (GC clusters included) can hold them without the GC seeing the reference. Unused copies are
+ * dropped after each garbage collection (or with Scriptable.Conditions.TrimTemplates).
+ * Only active in games (never in the editor, where templates are still being edited). Game thread only.
+ */
+class FScriptableConditionTemplateCache : public FGCObject
+{
+public:
+	static bool IsEnabled();
+
+	/** Drops the canonical copies no loaded package uses anymore. */
+	static void Trim();
+
+	/** Called by the module. */
+	static void Startup();
+	static void Shutdown();
+
+	//~ FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FScriptableConditionTemplateCache"); }
+
+private:
+	struct FEntry
+	{
+		TObjectPtr<UScriptableCondition> Template;
+
+		/** Packages whose requirements point at Template. */
+		TArray<TWeakObjectPtr<UPackage>> Users;
+	};
+
+	static FScriptableConditionTemplateCache* Get();
+
+	static void OnEndLoadPackage(const FEndLoadPackageContext& Context);
+
+	/** True if the template only references asset objects, so a copy of it can outlive the package it was loaded from. */
+	static bool CanShare(const UScriptableCondition& Template);
+
+	/** Points the shared templates of every requirement of Owner at their canonical instance. */
+	void CanonicalizeRequirements(UObject* Owner);
+
+	/** Returns the canonical instance equivalent to Template, creating it on first use, and records User as using it. */
+	UScriptableCondition* Canonicalize(UScriptableCondition* Template, UPackage* User);
+
+	/** Template hash -> canonical instances with that hash. */
+	TMap<uint32, TArray<FEntry>> Templates;
+	int32 NumTemplates = 0;
+
+	FDelegateHandle EndLoadPackageHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+};
@@ -7,7 +7,7 @@
 FText UScriptableCondition_CompareNumbers::GetDisplayTitle() const
 {
 	FString OpStr;
-	switch (Operation)
+	switch (InstanceData.Operation)
 	{
 		case EScriptableComparisonOp::Equal:          OpStr = TEXT("=="); break;
 		case EScriptableComparisonOp::NotEqual:       OpStr = TEXT("!="); break;
@@ -21,7 +21,7 @@ FText UScriptableCondition_CompareNumbers::GetDisplayTitle() const
 	auto GetValueText = [this](FName PropName, double CurrentValue) -> FText
 	{
 		FString BindingName;
-		if (GetBindingDisplayText(PropName, BindingName))
+		if (GetInstanceDataBindingDisplayText(PropName, BindingName))
 		{
 			return FText::FromString(BindingName);
 		}
@@ -33,34 +33,36 @@ FText UScriptableCondition_CompareNumbers::GetDisplayTitle() const
 
 	// Format: [Health] [>] [50.0]
 	return FText::Format(INVTEXT("{0} {1} {2}"),
-											 GetValueText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A), A),
+											 GetValueText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_CompareNumbersInstanceData, A), InstanceData.A),
 											 FText::FromString(OpStr),
-											 GetValueText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B), B)
+											 GetValueText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_CompareNumbersInstanceData, B), InstanceData.B)
 	);
 }
 #endif
 
 bool UScriptableCondition_CompareNumbers::Evaluate_Implementation() const
 {
-	switch (Operation)
+	const FScriptableCondition_CompareNumbersInstanceData& Data = GetInstanceData<FScriptableCondition_CompareNumbersInstanceData>();
+
+	switch (Data.Operation)
 	{
 		case EScriptableComparisonOp::Equal:
-		return FMath::IsNearlyEqual(A, B, ErrorTolerance);
+		return FMath::IsNearlyEqual(Data.A, Data.B, Data.ErrorTolerance);
 
 		case EScriptableComparisonOp::NotEqual:
-		return !FMath::IsNearlyEqual(A, B, ErrorTolerance);
+		return !FMath::IsNearlyEqual(Data.A, Data.B, Data.ErrorTolerance);
 
 		case EScriptableComparisonOp::Less:
-		return A < B;
+		return Data.A < Data.B;
 
 		case EScriptableComparisonOp::LessOrEqual:
-		return A <= B;
+		return Data.A <= Data.B;
 
 		case EScriptableComparisonOp::Greater:
-		return A > B;
+		return Data.A > Data.B;
 
 		case EScriptableComparisonOp::GreaterOrEqual:
-		return A >= B;
+		return Data.A >= Data.B;
 	}
 
 	return false;
@@ -70,7 +72,7 @@ bool UScriptableCondition_CompareNumbers::Evaluate_Implementation() const
 FText UScriptableCondition_Distance::GetDisplayTitle() const
 {
 	FString OpStr;
-	switch (Operation)
+	switch (InstanceData.Operation)
 	{
 		case EScriptableComparisonOp::Equal:          OpStr = TEXT("=="); break;
 		case EScriptableComparisonOp::NotEqual:       OpStr = TEXT("!="); break;
@@ -84,7 +86,7 @@ FText UScriptableCondition_Distance::GetDisplayTitle() const
 	auto GetActorText = [this](FName PropName, AActor* Actor) -> FText
 	{
 		FString BindingName;
-		if (GetBindingDisplayText(PropName, BindingName))
+		if (GetInstanceDataBindingDisplayText(PropName, BindingName))
 		{
 			return FText::FromString(BindingName);
 		}
@@ -95,7 +97,7 @@ FText UScriptableCondition_Distance::GetDisplayTitle() const
 	auto GetDistanceText = [this](double Val) -> FText
 	{
 		FString BindingName;
-		if (GetBindingDisplayText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Distance), BindingName))
+		if (GetInstanceDataBindingDisplayText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_DistanceInstanceData, Distance), BindingName))
 		{
 			return FText::FromString(BindingName);
 		}
@@ -104,25 +106,27 @@ FText UScriptableCondition_Distance::GetDisplayTitle() const
 
 	// Format: Distance(Self, Target) < 500
 	return FText::Format(INVTEXT("Distance({0}, {1}) {2} {3}"),
-											 GetActorText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Origin), Origin),
-											 GetActorText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Target), Target),
+											 GetActorText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_DistanceInstanceData, Origin), InstanceData.Origin),
+											 GetActorText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_DistanceInstanceData, Target), InstanceData.Target),
 											 FText::FromString(OpStr),
-											 GetDistanceText(Distance)
+											 GetDistanceText(InstanceData.Distance)
 	);
 }
 #endif
 
 bool UScriptableCondition_Distance::Evaluate_Implementation() const
 {
-	if (!Origin || !Target)
+	const FScriptableCondition_DistanceInstanceData& Data = GetInstanceData<FScriptableCondition_DistanceInstanceData>();
+
+	if (!Data.Origin || !Data.Target)
 	{
 		return false;
 	}
 
-	const float ActualDistanceSq = Origin->GetSquaredDistanceTo(Target);
-	const float ThresholdSq = FMath::Square(Distance);
+	const float ActualDistanceSq = Data.Origin->GetSquaredDistanceTo(Data.Target);
+	const float ThresholdSq = FMath::Square(Data.Distance);
 
-	switch (Operation)
+	switch (Data.Operation)
 	{
 		case EScriptableComparisonOp::Equal:          return FMath::IsNearlyEqual(ActualDistanceSq, ThresholdSq, 1.e-4);
 		case EScriptableComparisonOp::NotEqual:       return !FMath::IsNearlyEqual(ActualDistanceSq, ThresholdSq, 1.e-4);
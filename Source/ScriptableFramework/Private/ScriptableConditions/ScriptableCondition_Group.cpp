@@ -20,6 +20,14 @@ void UScriptableCondition_Group::OnUnregister()
 	Requirement.Unregister();
 }
 
+void UScriptableCondition_Group::InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
+{
+	Super::InitRuntimeData(InContextScope, InBindingMap);
+
+	// The registered Requirement chains to our scope, keep it in sync.
+	Requirement.UpdateParentScope(GetContextScope());
+}
+
 bool UScriptableCondition_Group::Evaluate_Implementation() const
 {
 	return Requirement.Evaluate();
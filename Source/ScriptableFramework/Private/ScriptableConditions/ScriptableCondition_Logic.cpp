@@ -10,7 +10,7 @@
 FText UScriptableCondition_Bool::GetDisplayTitle() const
 {
 	FString BindingName;
-	const bool bIsBound = GetBindingDisplayText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_Bool, bValue), BindingName);
+	const bool bIsBound = GetInstanceDataBindingDisplayText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_BoolInstanceData, bValue), BindingName);
 
 	// Determine prefix based on the base class negation flag
 	const FString Prefix = IsNegated() ? TEXT("!") : TEXT("");
@@ -25,7 +25,7 @@ FText UScriptableCondition_Bool::GetDisplayTitle() const
 		// Case: Static Value.
 		// We manually calculate the visual result to be clear:
 		// If bValue is true and bNegate is true -> Display "Is False"
-		const bool bFinalResult = IsNegated() ? !bValue : bValue;
+		const bool bFinalResult = IsNegated() ? !InstanceData.bValue : InstanceData.bValue;
 		return bFinalResult ? INVTEXT("Is True") : INVTEXT("Is False");
 	}
 }
@@ -35,14 +35,14 @@ bool UScriptableCondition_Bool::Evaluate_Implementation() const
 {
 	// Simply return the value. 
 	// The base class handles the 'bNegate' logic on the result of this function.
-	return bValue;
+	return GetInstanceData<FScriptableCondition_BoolInstanceData>().bValue;
 }
 
 #if WITH_EDITOR
 FText UScriptableCondition_CompareBooleans::GetDisplayTitle() const
 {
 	FString OpStr;
-	switch (Operation)
+	switch (InstanceData.Operation)
 	{
 		case EScriptableBoolOp::And:      OpStr = TEXT("AND"); break;
 		case EScriptableBoolOp::Or:       OpStr = TEXT("OR"); break;
@@ -56,7 +56,7 @@ FText UScriptableCondition_CompareBooleans::GetDisplayTitle() const
 	auto GetValueText = [this](FName PropName, bool CurrentValue) -> FText
 	{
 		FString BindingName;
-		if (GetBindingDisplayText(PropName, BindingName))
+		if (GetInstanceDataBindingDisplayText(PropName, BindingName))
 		{
 			return FText::FromString(BindingName);
 		}
@@ -65,23 +65,25 @@ FText UScriptableCondition_CompareBooleans::GetDisplayTitle() const
 
 	// Format: [IsActive] [AND] [IsAlive]
 	return FText::Format(INVTEXT("{0} {1} {2}"),
-											 GetValueText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareBooleans, bA), bA),
+											 GetValueText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_CompareBooleansInstanceData, bA), InstanceData.bA),
 											 FText::FromString(OpStr),
-											 GetValueText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareBooleans, bB), bB)
+											 GetValueText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_CompareBooleansInstanceData, bB), InstanceData.bB)
 	);
 }
 #endif
 
 bool UScriptableCondition_CompareBooleans::Evaluate_Implementation() const
 {
-	switch (Operation)
+	const FScriptableCondition_CompareBooleansInstanceData& Data = GetInstanceData<FScriptableCondition_CompareBooleansInstanceData>();
+
+	switch (Data.Operation)
 	{
-		case EScriptableBoolOp::And:      return bA && bB;
-		case EScriptableBoolOp::Or:       return bA || bB;
-		case EScriptableBoolOp::Xor:      return bA ^ bB;
-		case EScriptableBoolOp::Nand:     return !(bA && bB);
-		case EScriptableBoolOp::Equal:    return bA == bB;
-		case EScriptableBoolOp::NotEqual: return bA != bB;
+		case EScriptableBoolOp::And:      return Data.bA && Data.bB;
+		case EScriptableBoolOp::Or:       return Data.bA || Data.bB;
+		case EScriptableBoolOp::Xor:      return Data.bA ^ Data.bB;
+		case EScriptableBoolOp::Nand:     return !(Data.bA && Data.bB);
+		case EScriptableBoolOp::Equal:    return Data.bA == Data.bB;
+		case EScriptableBoolOp::NotEqual: return Data.bA != Data.bB;
 	}
 	return false;
 }
@@ -94,27 +96,27 @@ bool UScriptableCondition_CompareBooleans::Evaluate_Implementation() const
 FText UScriptableCondition_Probability::GetDisplayTitle() const
 {
 	FString BindingName;
-	if (GetBindingDisplayText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_Probability, Chance), BindingName))
+	if (GetInstanceDataBindingDisplayText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_ProbabilityInstanceData, Chance), BindingName))
 	{
 		return FText::Format(INVTEXT("{0} Chance"), FText::FromString(BindingName));
 	}
 
 	// Format: "35% Chance"
-	const int32 Percent = FMath::RoundToInt(Chance * 100.0f);
+	const int32 Percent = FMath::RoundToInt(InstanceData.Chance * 100.0f);
 	return FText::Format(INVTEXT("{0}% Chance"), FText::AsNumber(Percent));
 }
 #endif
 
 bool UScriptableCondition_Probability::Evaluate_Implementation() const
 {
-	return FMath::FRand() < Chance;
+	return FMath::FRand() < GetInstanceData<FScriptableCondition_ProbabilityInstanceData>().Chance;
 }
 
 #if WITH_EDITOR
 FText UScriptableCondition_IsValid::GetDisplayTitle() const
 {
 	FString Name = TEXT("...");
-	GetBindingDisplayText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_IsValid, TargetObject), Name);
+	GetInstanceDataBindingDisplayText(GET_MEMBER_NAME_CHECKED(FScriptableCondition_IsValidInstanceData, TargetObject), Name);
 
 	const FText ValidText = IsNegated() ? INVTEXT("Is Not Valid") : INVTEXT("Is Valid");
 	return FText::Format(INVTEXT("{0} ({1})"), ValidText, FText::FromString(Name));
@@ -123,5 +125,5 @@ FText UScriptableCondition_IsValid::GetDisplayTitle() const
 
 bool UScriptableCondition_IsValid::Evaluate_Implementation() const
 {
-	return IsValid(TargetObject);
+	return IsValid(GetInstanceData<FScriptableCondition_IsValidInstanceData>().TargetObject);
 }
\ No newline at end of file
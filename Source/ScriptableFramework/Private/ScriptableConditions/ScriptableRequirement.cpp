@@ -2,8 +2,6 @@
 
 #include "ScriptableConditions/ScriptableRequirement.h"
 #include "ScriptableConditions/ScriptableCondition.h"
-#include "Algo/AllOf.h"
-#include "Algo/AnyOf.h"
 
 void FScriptableRequirement::Register(UObject* InOwner)
 {
@@ -14,29 +12,49 @@ void FScriptableRequirement::Register(UObject* InOwner)
 
 	Super::Register(InOwner);
 
-	// Filter invalid conditions
+	// Filter invalid conditions, and conditions stripped from this build (a cooked build won't have loaded them at all)
 	for (int32 i = Conditions.Num() - 1; i >= 0; --i)
 	{
-		if (!Conditions[i])
+		if (!Conditions[i] || !Conditions[i]->IsIncludedInBuild())
 		{
 			Conditions.RemoveAt(i);
 		}
 	}
 
-	for (UScriptableCondition* Condition : Conditions)
+	ConditionInstanceData.Reset();
+	ConditionInstanceData.SetNum(Conditions.Num());
+	ConditionBindingCaches.Reset();
+	ConditionBindingCaches.SetNum(Conditions.Num());
+
+	for (int32 Index = 0; Index < Conditions.Num(); ++Index)
 	{
-		if (Condition)
+		UScriptableCondition* Condition = Conditions[Index];
+
+		if (Condition->IsSharedTemplate())
 		{
-			// Add to local map and inject THIS Context into the condition
-			AddBindingSource(Condition);
+			// Shared templates are never registered, injected or used as binding sources (the editor doesn't offer them), they only get their own instance data.
+			Condition->InitInstanceData(ConditionInstanceData[Index]);
+			continue;
+		}
 
-			if (Condition->IsEnabled())
-			{
-				Condition->Register(Owner);
-			}
+		// Add to local map and inject THIS Context into the condition
+		AddBindingSource(Condition);
+
+		if (Condition->IsEnabled())
+		{
+			Condition->Register(Owner);
 		}
 	}
 
+	ConditionNodeInstanceData.Reset();
+	ConditionNodeInstanceData.SetNum(ConditionNodes.Num());
+
+	for (int32 Index = 0; Index < ConditionNodes.Num(); ++Index)
+	{
+		const FScriptableConditionNode* Node = ConditionNodes[Index].GetPtr<FScriptableConditionNode>();
+		ConditionNodeInstanceData[Index].InitializeAs(Node ? Node->GetInstanceDataType() : nullptr);
+	}
+
 	bIsRegistered = true;
 }
 
@@ -49,12 +67,15 @@ void FScriptableRequirement::Unregister()
 
 	for (UScriptableCondition* Condition : Conditions)
 	{
-		if (Condition && Condition->IsEnabled())
+		if (Condition && Condition->IsRegistered())
 		{
 			Condition->Unregister();
 		}
 	}
 
+	ConditionInstanceData.Reset();
+	ConditionBindingCaches.Reset();
+	ConditionNodeInstanceData.Reset();
 	bIsRegistered = false;
 	Super::Unregister();
 }
@@ -63,39 +84,99 @@ bool FScriptableRequirement::Evaluate() const
 {
 	bool bResult = true;
 
-	if (Conditions.IsEmpty())
+	if (IsEmpty())
 	{
 		// AND: Empty = True, OR: Empty = False
 		bResult = (Mode == EScriptableRequirementMode::And);
 	}
 	else
 	{
-		auto EvalPredicate = [](UScriptableCondition* Condition)
+		FScriptableConditionInstance Instance;
+		Instance.Owner = Owner;
+		Instance.Context = GetEffectiveContext();
+		Instance.BindingMap = &GetBindingSourceMap();
+
+		auto EvalCondition = [this, &Instance](int32 Index)
+		{
+			UScriptableCondition* Condition = Conditions[Index];
+			if (!Condition)
+			{
+				return false;
+			}
+
+			if (Condition->IsSharedTemplate())
+			{
+				// Instance data is runtime state, writable even when evaluating through a const requirement.
+				Instance.InstanceData = ConditionInstanceData.IsValidIndex(Index) ? FStructView(const_cast<FInstancedStruct&>(ConditionInstanceData[Index])) : FStructView();
+				Instance.BindingCache = ConditionBindingCaches.IsValidIndex(Index) ? &ConditionBindingCaches[Index] : nullptr;
+				return Condition->CheckCondition(Instance);
+			}
+
+			return Condition->CheckCondition();
+		};
+
+		auto EvalConditionNode = [this, &Instance](int32 Index)
 		{
-			return Condition ? Condition->CheckCondition() : false;
+			const FScriptableConditionNode* Node = ConditionNodes[Index].GetPtr<FScriptableConditionNode>();
+			if (!Node)
+			{
+				return false;
+			}
+
+			Instance.InstanceData = ConditionNodeInstanceData.IsValidIndex(Index) ? FStructView(const_cast<FInstancedStruct&>(ConditionNodeInstanceData[Index])) : FStructView();
+			Instance.BindingCache = nullptr;
+			return Node->CheckCondition(Instance);
 		};
 
-		if (Mode == EScriptableRequirementMode::And)
+		const bool bAnd = (Mode == EScriptableRequirementMode::And);
+
+		// AND: stop at the first failure, OR: stop at the first success.
+		// Struct conditions go first, then Conditions in authored order.
+		bResult = bAnd;
+		for (int32 Index = 0; Index < ConditionNodes.Num() && bResult == bAnd; ++Index)
 		{
-			bResult = Algo::AllOf(Conditions, EvalPredicate);
+			if (EvalConditionNode(Index) != bAnd)
+			{
+				bResult = !bAnd;
+			}
 		}
-		else
+
+		for (int32 Index = 0; Index < Conditions.Num() && bResult == bAnd; ++Index)
 		{
-			bResult = Algo::AnyOf(Conditions, EvalPredicate);
+			if (EvalCondition(Index) != bAnd)
+			{
+				bResult = !bAnd;
+			}
 		}
 	}
 
 	return bNegate ? !bResult : bResult;
 }
 
+bool FScriptableRequirement::Evaluate(TConstArrayView<FConstStructView> ContextSources) const
+{
+	if (!ensureMsgf(bIsRegistered, TEXT("External context requires a registered requirement.")))
+	{
+		return false;
+	}
+
+	FExternalContextGuard ContextGuard(*this, ContextSources);
+	return Evaluate();
+}
+
 bool FScriptableRequirement::EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement)
+{
+	return EvaluateRequirement(Owner, Requirement, {});
+}
+
+bool FScriptableRequirement::EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement, TConstArrayView<FConstStructView> ContextSources)
 {
 	if (!Owner) return false;
 
 	FScriptableRequirement& MutableReq = const_cast<FScriptableRequirement&>(Requirement);
 
 	MutableReq.Register(Owner);
-	const bool bResult = MutableReq.Evaluate();
+	const bool bResult = ContextSources.IsEmpty() ? MutableReq.Evaluate() : MutableReq.Evaluate(ContextSources);
 	MutableReq.Unregister();
 
 	return bResult;
@@ -3,49 +3,29 @@
 #include "ScriptableConditions/ScriptableRequirementAsset.h"
 #include "ScriptableConditions/ScriptableCondition.h"
 #include "ScriptableConditions/ScriptableCondition_Group.h"
+#include "Utils/ScriptableContextBagPool.h"
 
 void UScriptableCondition_Asset::OnRegister()
 {
 	Super::OnRegister();
 
-	if (Asset)
+	if (bHasInlinedRequirement)
+	{
+		// The cooked copy layers its Context on top of our scope, like the group would.
+		InlinedRequirement.Register(this);
+	}
+	else if (Asset)
 	{
 		// 1. Create a transient Group to act as the runtime container.
 		// We use a Group because it already encapsulates the logic for FScriptableRequirement (Evaluation + Bindings).
-		UScriptableCondition_Group* Group = NewObject<UScriptableCondition_Group>(this, NAME_None, RF_Transient);
+		UScriptableCondition_Group* Group = CreateGroupFromAsset();
 
 		if (Group)
 		{
-			// 2. Copy struct properties (Mode, Negate, Context)
-			// This performs a copy of the PropertyBag, preserving default values from the Asset.
-			Group->Requirement.Mode = Asset->Requirement.Mode;
-			Group->Requirement.bNegate = Asset->Requirement.bNegate;
-
-			if (const FInstancedPropertyBag* ParentContext = GetContext())
-			{
-				Group->Requirement.Context = *ParentContext;
-			}
-
-			// 3. Deep Copy Conditions
-			// We MUST duplicate the conditions. If we just copy the pointers, registering them 
-			// would modify the objects inside the Asset (changing their Outer/Bindings), which is bad.
-			const int32 NumConds = Asset->Requirement.Conditions.Num();
-			Group->Requirement.Conditions.Reset(NumConds);
-
-			for (const UScriptableCondition* SourceCond : Asset->Requirement.Conditions)
-			{
-				if (SourceCond)
-				{
-					// Duplicate using 'Group' as the new outer.
-					UScriptableCondition* NewCond = DuplicateObject<UScriptableCondition>(SourceCond, Group);
-					Group->Requirement.Conditions.Add(NewCond);
-				}
-			}
-
-			// 4. Assign to our internal pointer
+			// 2. Assign to our internal pointer
 			Condition = Group;
 
-			// 5. Inject Runtime Data & Register
+			// 3. Inject Runtime Data & Register
 			// This passes the Stack down to the Group, which passes it to its children + the new Asset Context.
 			PropagateRuntimeData(Condition);
 			Condition->Register(GetOwner());
@@ -55,19 +35,89 @@ void UScriptableCondition_Asset::OnRegister()
 
 void UScriptableCondition_Asset::OnUnregister()
 {
+	if (bHasInlinedRequirement)
+	{
+		InlinedRequirement.Unregister();
+
+		// Kept for the next registration, only drop the values pulled from the caller.
+		InlinedRequirement.Context.CopyMatchingValuesByID(InlinedContextDefaults);
+	}
+
 	if (Condition)
 	{
 		Condition->Unregister();
+		FScriptableContextBagPool::Release(Condition->Requirement.Context);
+
 		Condition = nullptr; // Release the transient group
 	}
 
 	Super::OnUnregister();
 }
 
+void UScriptableCondition_Asset::InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
+{
+	Super::InitRuntimeData(InContextScope, InBindingMap);
+
+	if (bHasInlinedRequirement)
+	{
+		// The registered requirement chains to our scope, keep it in sync.
+		InlinedRequirement.UpdateParentScope(GetContextScope());
+	}
+
+	if (Condition)
+	{
+		PropagateRuntimeData(Condition);
+	}
+}
+
+UScriptableCondition_Group* UScriptableCondition_Asset::CreateGroupFromAsset()
+{
+	UScriptableCondition_Group* Group = NewObject<UScriptableCondition_Group>(this, NAME_None, RF_Transient);
+
+	// 1. Copy struct properties (Mode, Negate, Context)
+	// The Group keeps the Asset's declared Context (with its defaults) and layers it on top of our scope,
+	// the parent bag is not copied. The bag memory is recycled from previous registrations.
+	Group->Requirement.Mode = Asset->Requirement.Mode;
+	Group->Requirement.bNegate = Asset->Requirement.bNegate;
+	FScriptableContextBagPool::CopyFrom(Group->Requirement.Context, Asset->Requirement.Context);
+
+	// 2. Deep Copy Conditions
+	// We MUST duplicate the conditions. If we just copy the pointers, registering them 
+	// would modify the objects inside the Asset (changing their Outer/Bindings), which is bad.
+	const int32 NumConds = Asset->Requirement.Conditions.Num();
+	Group->Requirement.Conditions.Reset(NumConds);
+
+	// Shared templates (never registered or mutated) are referenced directly, the rest get runtime copies.
+	for (UScriptableCondition* SourceCond : Asset->Requirement.Conditions)
+	{
+		if (SourceCond)
+		{
+			// Duplicate using 'Group' as the new outer.
+			UScriptableCondition* NewCond = SourceCond->IsSharedTemplate() ? SourceCond : DuplicateForRuntime<UScriptableCondition>(SourceCond, Group);
+			Group->Requirement.Conditions.Add(NewCond);
+		}
+	}
+
+	// Struct conditions are plain data, a copy is enough.
+	Group->Requirement.ConditionNodes = Asset->Requirement.ConditionNodes;
+
+	return Group;
+}
+
 bool UScriptableCondition_Asset::Evaluate_Implementation() const
 {
+	if (bHasInlinedRequirement)
+	{
+		// Pulled parameters are runtime state of the cooked copy, like the transient group's.
+		FScriptableRequirement& Requirement = const_cast<FScriptableRequirement&>(InlinedRequirement);
+		Requirement.PullContextFromParent();
+		return Requirement.Evaluate();
+	}
+
 	if (Condition)
 	{
+		// Declared parameters take the caller's current values, like Run Asset does on every begin.
+		Condition->Requirement.PullContextFromParent();
 		return Condition->CheckCondition();
 	}
 	return false;
@@ -78,4 +128,39 @@ FText UScriptableCondition_Asset::GetDisplayTitle() const
 {
 	return Asset ? FText::FromString(Asset->GetName()) : INVTEXT("None");
 }
-#endif
\ No newline at end of file
+
+void UScriptableCondition_Asset::InlineReferencedAssets(TArray<const UObject*>& AssetStack)
+{
+	// Recursive references keep the runtime path.
+	if (!Asset || bHasInlinedRequirement || AssetStack.Contains(Asset))
+	{
+		return;
+	}
+
+	InlinedRequirement = Asset->Requirement;
+	InlinedContextDefaults = Asset->Requirement.Context;
+
+	// Plain duplication: these copies are saved with the host, so they keep their own binding lists,
+	// and a private object of another package can't be referenced.
+	for (TObjectPtr<UScriptableCondition>& InlinedCondition : InlinedRequirement.Conditions)
+	{
+		if (InlinedCondition)
+		{
+			InlinedCondition = DuplicateObject<UScriptableCondition>(InlinedCondition, this);
+		}
+	}
+
+	bHasInlinedRequirement = true;
+
+	// Self-contained from here on, the cooked condition doesn't need (or load) the asset.
+	const UScriptableRequirementAsset* InlinedAsset = Asset;
+	Asset = nullptr;
+
+	AssetStack.Push(InlinedAsset);
+	for (UScriptableCondition* InlinedCondition : InlinedRequirement.Conditions)
+	{
+		InlineReferencedAssetsInHierarchy(InlinedCondition, AssetStack);
+	}
+	AssetStack.Pop();
+}
+#endif
@@ -3,6 +3,29 @@
 #include "ScriptableContainer.h"
 #include "ScriptableObject.h"
 
+FScriptableContainer::FScriptableContainer(const FScriptableContainer& Other)
+	: Context(Other.Context)
+	, ContextStruct(Other.ContextStruct)
+{
+}
+
+FScriptableContainer& FScriptableContainer::operator=(const FScriptableContainer& Other)
+{
+	if (this != &Other)
+	{
+		Context = Other.Context;
+		ContextStruct = Other.ContextStruct;
+
+		Owner = nullptr;
+		BindingSourceMap.Reset();
+		LocalScope = FScriptableContextScope();
+		ExternalContext.Reset();
+		ParentScopeOverride = nullptr;
+		bLocalScopeHandedOut = false;
+	}
+	return *this;
+}
+
 UScriptableObject* FScriptableContainer::FindBindingSource(const FGuid& InID) const
 {
 	if (const TObjectPtr<UScriptableObject>* Found = BindingSourceMap.Find(InID))
@@ -16,39 +39,151 @@ void FScriptableContainer::AddBindingSource(UScriptableObject* InSource)
 {
 	if (InSource)
 	{
-		const FInstancedPropertyBag* ContextToUse = nullptr;
+		// Inject Data
+		InSource->InitRuntimeData(GetEffectiveContext(), &BindingSourceMap);
 
-		// 1. Determine which Context to pass down.
-		// If our local context is valid and has properties, use it (it acts as the top-most scope).
-		if (Context.IsValid() && Context.GetNumPropertiesInBag() > 0)
+		FGuid ID = InSource->GetBindingID();
+		if (ID.IsValid())
 		{
-			ContextToUse = &Context;
+			BindingSourceMap.Add(ID, InSource);
 		}
-		// Otherwise, try to inherit the context from the Owner (Parent Scope).
-		else if (UScriptableObject* ScriptableOwner = Cast<UScriptableObject>(Owner))
+	}
+}
+
+const FScriptableContextScope* FScriptableContainer::GetEffectiveContext() const
+{
+	// Only registered containers have a live scope.
+	if (!LocalScope.Bag)
+	{
+		return LocalScope.Parent;
+	}
+
+	if (bLocalScopeHandedOut || LocalScope.Struct.IsValid() || LocalScope.Bag->GetNumPropertiesInBag() > 0 || !LocalScope.ExternalStructs.IsEmpty())
+	{
+		bLocalScopeHandedOut = true;
+		return &LocalScope;
+	}
+
+	return LocalScope.Parent;
+}
+
+void FScriptableContainer::RefreshChildScopes() const
+{
+	if (bLocalScopeHandedOut || !LocalScope.Bag || GetEffectiveContext() != &LocalScope)
+	{
+		return;
+	}
+
+	for (const TPair<FGuid, TObjectPtr<UScriptableObject>>& Pair : BindingSourceMap)
+	{
+		if (Pair.Value)
 		{
-			ContextToUse = ScriptableOwner->GetContext();
+			Pair.Value->InitRuntimeData(&LocalScope, &BindingSourceMap);
 		}
+	}
+}
 
-		// 2. Inject Data
-		InSource->InitRuntimeData(ContextToUse, &BindingSourceMap);
+void FScriptableContainer::UpdateParentScope(const FScriptableContextScope* InParentScope)
+{
+	if (ParentScopeOverride)
+	{
+		ParentScopeOverride = InParentScope;
+	}
 
-		FGuid ID = InSource->GetBindingID();
-		if (ID.IsValid())
+	if (!LocalScope.Bag || LocalScope.Parent == InParentScope)
+	{
+		return;
+	}
+
+	LocalScope.Parent = InParentScope;
+
+	// Children given our layer follow the new parent through it.
+	if (!bLocalScopeHandedOut)
+	{
+		for (const TPair<FGuid, TObjectPtr<UScriptableObject>>& Pair : BindingSourceMap)
 		{
-			BindingSourceMap.Add(ID, InSource);
+			if (Pair.Value)
+			{
+				Pair.Value->InitRuntimeData(GetEffectiveContext(), &BindingSourceMap);
+			}
+		}
+	}
+}
+
+void FScriptableContainer::SetExternalContext(TConstArrayView<FConstStructView> Views)
+{
+	ExternalContext = Views;
+	LocalScope.ExternalStructs = ExternalContext;
+	RefreshChildScopes();
+}
+
+FScriptableContainer::FExternalContextGuard::FExternalContextGuard(const FScriptableContainer& Container, TConstArrayView<FConstStructView> Views)
+	: Scope(const_cast<FScriptableContextScope&>(Container.LocalScope))
+	, PreviousViews(Container.LocalScope.ExternalStructs)
+{
+	// Binding caches check the layouts of the chain they were built for, so repeated evaluations with the same struct types keep them.
+	Scope.ExternalStructs = Views;
+	Container.RefreshChildScopes();
+}
+
+FScriptableContainer::FExternalContextGuard::~FExternalContextGuard()
+{
+	Scope.ExternalStructs = PreviousViews;
+}
+
+void FScriptableContainer::PullContextFromParent()
+{
+	const UPropertyBag* BagStruct = Context.GetPropertyBagStruct();
+	if (!BagStruct || !LocalScope.Parent)
+	{
+		return;
+	}
+
+	uint8* LocalMemory = Context.GetMutableValue().GetMemory();
+
+	for (const FPropertyBagPropertyDesc& Desc : BagStruct->GetPropertyDescs())
+	{
+		// Parent layers can be bags or fixed structs, so compare the properties themselves.
+		const FProperty* ParentProperty = nullptr;
+		const FPropertyBindingDataView ParentView = LocalScope.Parent->FindViewWithProperty(Desc.Name, &ParentProperty);
+
+		if (ParentView.IsValid() && ParentProperty && Desc.CachedProperty && ParentProperty->SameType(Desc.CachedProperty))
+		{
+			Desc.CachedProperty->CopyCompleteValue(Desc.CachedProperty->ContainerPtrToValuePtr<void>(LocalMemory), ParentProperty->ContainerPtrToValuePtr<void>(ParentView.GetMemory()));
 		}
 	}
 }
 
+void FScriptableContainer::OnContextStructChanged()
+{
+	// Only registered containers have a live scope.
+	if (LocalScope.Bag)
+	{
+		LocalScope.Struct = FConstStructView(ContextStruct);
+		RefreshChildScopes();
+	}
+}
+
 void FScriptableContainer::Register(UObject* InOwner)
 {
 	Owner = InOwner;
 	BindingSourceMap.Reset(); // Clean slate
+
+	// Rebuilt on every registration, the container may have been copied since.
+	const UScriptableObject* ScriptableOwner = Cast<UScriptableObject>(Owner);
+	LocalScope.Bag = &Context;
+	LocalScope.Struct = FConstStructView(ContextStruct);
+	LocalScope.ExternalStructs = ExternalContext;
+	LocalScope.Parent = ParentScopeOverride ? ParentScopeOverride : (ScriptableOwner ? ScriptableOwner->GetContextScope() : nullptr);
+	bLocalScopeHandedOut = false;
 }
 
 void FScriptableContainer::Unregister()
 {
 	BindingSourceMap.Empty();
+	ExternalContext.Reset();
+	LocalScope = FScriptableContextScope();
+	ParentScopeOverride = nullptr;
+	bLocalScopeHandedOut = false;
 	Owner = nullptr;
 }
\ No newline at end of file
@@ -1,18 +1,24 @@
 // Copyright 2025 kirzo
 
 #include "ScriptableFramework.h"
+#include "Utils/ScriptableContextBagPool.h"
+#include "ScriptableConditions/ScriptableConditionTemplateCache.h"
 
 #define LOCTEXT_NAMESPACE "FScriptableFrameworkModule"
 
 void FScriptableFrameworkModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FScriptableContextBagPool::Startup();
+	FScriptableConditionTemplateCache::Startup();
 }
 
 void FScriptableFrameworkModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FScriptableConditionTemplateCache::Shutdown();
+	FScriptableContextBagPool::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -1,12 +1,36 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableObject.h"
+#include "ScriptableObjectRegistry.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Misc/SecureHash.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectSaveContext.h"
+
+#if WITH_EDITOR
+#include "Settings/ProjectPackagingSettings.h"
+#endif
 
 DEFINE_LOG_CATEGORY(LogScriptableObject);
 
+namespace ScriptableObject
+{
+	static int32 StripDevelopmentNodesOnCook = 2;
+	static FAutoConsoleVariableRef CVarStripDevelopmentNodesOnCook(
+		TEXT("Scriptable.Cook.StripDevelopmentNodes"),
+		StripDevelopmentNodesOnCook,
+		TEXT("Whether cooking excludes scriptable objects marked Development Only.\n")
+		TEXT("0: never, 1: always, 2: when the project's packaging build configuration is Shipping (default).\n")
+		TEXT("Set it to 1 for shipping cooks that are not driven by the packaging settings."));
+
+	static bool bInlineAssetsOnCook = true;
+	static FAutoConsoleVariableRef CVarInlineAssetsOnCook(
+		TEXT("Scriptable.Cook.InlineAssets"),
+		bInlineAssetsOnCook,
+		TEXT("If true, cooking copies the assets referenced by Run Asset / Evaluate Asset nodes into the package that uses them (asset, level or actor), so they are not duplicated at runtime."));
+}
+
 template<typename ExecuteTickLambda>
 void FScriptableObjectTickFunction::ExecuteTickHelper(UScriptableObject* Target, bool bTickInEditor, float DeltaTime, ELevelTick TickType, const ExecuteTickLambda& ExecuteTickFunc)
 {
@@ -30,7 +54,6 @@ void FScriptableObjectTickFunction::ExecuteTickHelper(UScriptableObject* Target,
 UScriptableObject::UScriptableObject()
 {
 	bCanEverTick = false;
-	PrimaryObjectTick.bCanEverTick = true;
 }
 
 void UScriptableObject::PostInitProperties()
@@ -55,9 +78,90 @@ void UScriptableObject::PostLoad()
 	{
 		BindingID = FGuid::NewGuid();
 	}
+
+#if WITH_EDITORONLY_DATA
+	// Tick settings used to be edited on the tick function itself. Move customized values over,
+	// and restore the defaults so they aren't applied again over later edits.
+	const FScriptableObjectTickSettings Defaults;
+	FScriptableObjectTickFunction& OldTick = PrimaryObjectTick_DEPRECATED;
+
+	if (OldTick.TickGroup != Defaults.TickGroup)
+	{
+		PrimaryObjectTickSettings.TickGroup = OldTick.TickGroup;
+		OldTick.TickGroup = Defaults.TickGroup;
+	}
+
+	if (OldTick.TickInterval != Defaults.TickInterval)
+	{
+		PrimaryObjectTickSettings.TickInterval = OldTick.TickInterval;
+		OldTick.TickInterval = Defaults.TickInterval;
+	}
+
+	if (OldTick.bStartWithTickEnabled != Defaults.bStartWithTickEnabled)
+	{
+		PrimaryObjectTickSettings.bStartWithTickEnabled = OldTick.bStartWithTickEnabled;
+		OldTick.bStartWithTickEnabled = Defaults.bStartWithTickEnabled;
+	}
+
+	if (OldTick.bTickEvenWhenPaused != Defaults.bTickEvenWhenPaused)
+	{
+		PrimaryObjectTickSettings.bTickEvenWhenPaused = OldTick.bTickEvenWhenPaused;
+		OldTick.bTickEvenWhenPaused = Defaults.bTickEvenWhenPaused;
+	}
+#endif
+}
+
+void UScriptableObject::BeginDestroy()
+{
+	// Objects destroyed while still registered must not leave a stale slot behind.
+	RemoveFromRegistry();
+
+	Super::BeginDestroy();
+}
+
+bool UScriptableObject::NeedsLoadForServer() const
+{
+	return NetTarget != EScriptableNetTarget::ClientOnly && Super::NeedsLoadForServer();
+}
+
+bool UScriptableObject::NeedsLoadForClient() const
+{
+	return NetTarget != EScriptableNetTarget::ServerOnly && Super::NeedsLoadForClient();
+}
+
+bool UScriptableObject::IsIncludedInBuild() const
+{
+#if UE_BUILD_SHIPPING
+	if (bDevelopmentOnly)
+	{
+		return false;
+	}
+#endif
+
+	// Same rules the cook applies, for content that was not cooked per target (editor, listen servers keep both).
+	if ((NetTarget == EScriptableNetTarget::ClientOnly && IsRunningDedicatedServer()) || (NetTarget == EScriptableNetTarget::ServerOnly && IsRunningClientOnly()))
+	{
+		return false;
+	}
+
+	return true;
 }
 
 #if WITH_EDITOR
+bool UScriptableObject::NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const
+{
+	if (bDevelopmentOnly)
+	{
+		const int32 StripMode = ScriptableObject::StripDevelopmentNodesOnCook;
+		if (StripMode == 1 || (StripMode == 2 && GetDefault<UProjectPackagingSettings>()->BuildConfiguration == EProjectPackagingBuildConfigurations::PPBC_Shipping))
+		{
+			return false;
+		}
+	}
+
+	return Super::NeedsLoadForTargetPlatform(TargetPlatform);
+}
+
 void UScriptableObject::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeChainProperty(PropertyChangedEvent);
@@ -99,9 +203,14 @@ FText UScriptableObject::GetDisplayTitle() const
 bool UScriptableObject::GetBindingDisplayText(FName PropertyName, FString& OutText, bool bChopPrefix) const
 {
 	FPropertyBindingPath TargetPath;
+	TargetPath.AddPathSegment(PropertyName);
+	return GetBindingDisplayText(MoveTemp(TargetPath), OutText, bChopPrefix);
+}
+
+bool UScriptableObject::GetBindingDisplayText(FPropertyBindingPath TargetPath, FString& OutText, bool bChopPrefix) const
+{
 	// Set the ID of this object instance so the binding system can find the correct entry
 	TargetPath.SetStructID(GetBindingID());
-	TargetPath.AddPathSegment(PropertyName);
 
 	// Check if there is a binding for this property
 	if (const FPropertyBindingPath* SourcePath = GetPropertyBindings().GetPropertyBinding(TargetPath))
@@ -131,6 +240,41 @@ bool UScriptableObject::GetBindingDisplayText(FName PropertyName, FString& OutTe
 
 	return false;
 }
+
+void UScriptableObject::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Every scriptable object of the saved package gets here, whatever owns it (an asset, an actor or a level),
+	// and each inlines its own references. Commandlet only: inlined copies must never end up in the editor's source packages.
+	if (SaveContext.IsCooking() && IsRunningCookCommandlet() && ScriptableObject::bInlineAssetsOnCook)
+	{
+		TArray<const UObject*> AssetStack;
+		AssetStack.Add(GetOutermostObject());
+		InlineReferencedAssets(AssetStack);
+	}
+}
+
+void UScriptableObject::InlineReferencedAssetsInHierarchy(UObject* Root, TArray<const UObject*>& AssetStack)
+{
+	if (!Root)
+	{
+		return;
+	}
+
+	// Gathered up front: inlining creates new subobjects, which inline their own nested assets.
+	TArray<UObject*> Objects;
+	Objects.Add(Root);
+	GetObjectsWithOuter(Root, Objects, true);
+
+	for (UObject* Object : Objects)
+	{
+		if (UScriptableObject* ScriptableObject = Cast<UScriptableObject>(Object))
+		{
+			ScriptableObject->InlineReferencedAssets(AssetStack);
+		}
+	}
+}
 #endif
 
 UWorld* UScriptableObject::GetWorld_Uncached() const
@@ -153,12 +297,21 @@ UWorld* UScriptableObject::GetWorld_Uncached() const
 	return MyWorld;
 }
 
-void UScriptableObject::OnWorldBeginTearDown(UWorld* InWorld)
+void UScriptableObject::RemoveFromRegistry()
 {
-	if (InWorld == GetWorld())
+	if (RegistryIndex == INDEX_NONE)
 	{
-		Unregister();
+		return;
 	}
+
+	// Cached pointer: this also runs from BeginDestroy, where the world may already be gone.
+	if (UScriptableObjectRegistry* CurrentRegistry = Registry.Get())
+	{
+		CurrentRegistry->RemoveObject(this);
+	}
+
+	Registry.Reset();
+	RegistryIndex = INDEX_NONE;
 }
 
 // -------------------------------------------------------------------
@@ -191,7 +344,7 @@ void UScriptableObject::Unregister()
 		return;
 	}
 
-	FWorldDelegates::OnWorldBeginTearDown.Remove(OnWorldBeginTearDownHandle);
+	RemoveFromRegistry();
 	RegisterTickFunctions(false);
 
 	// If registered, should have a world
@@ -200,8 +353,9 @@ void UScriptableObject::Unregister()
 	WorldPrivate = nullptr;
 	bRegistered = false;
 
-	ContextRef = nullptr;
+	ContextScopeRef = nullptr;
 	BindingsMapRef = nullptr;
+	BindingCache.Reset();
 
 	OnUnregister();
 }
@@ -258,7 +412,11 @@ void UScriptableObject::RegisterObjectWithWorld(UWorld* InWorld)
 
 	WorldPrivate = InWorld;
 
-	OnWorldBeginTearDownHandle = FWorldDelegates::OnWorldBeginTearDown.AddUObject(this, &UScriptableObject::OnWorldBeginTearDown);
+	// The registry unregisters us when the world is torn down.
+	if (UScriptableObjectRegistry* WorldRegistry = InWorld->GetSubsystem<UScriptableObjectRegistry>())
+	{
+		WorldRegistry->AddObject(this);
+	}
 
 	bRegistered = true;
 }
@@ -306,16 +464,29 @@ void UScriptableObject::RegisterTickFunctions(bool bRegister)
 {
 	if (bRegister)
 	{
-		if (SetupTickFunction(&PrimaryObjectTick))
+		// Most objects (e.g. all conditions) never tick, so the tick function is only allocated when needed.
+		if (!CanEverTick() || IsTemplate())
+		{
+			return;
+		}
+
+		if (!PrimaryObjectTick.IsValid())
+		{
+			PrimaryObjectTick = MakeUnique<FScriptableObjectTickFunction>();
+			PrimaryObjectTick->bCanEverTick = true;
+			PrimaryObjectTickSettings.ApplyTo(*PrimaryObjectTick);
+		}
+
+		if (SetupTickFunction(PrimaryObjectTick.Get()))
 		{
-			PrimaryObjectTick.Target = this;
+			PrimaryObjectTick->Target = this;
 		}
 	}
 	else
 	{
-		if (PrimaryObjectTick.IsTickFunctionRegistered())
+		if (PrimaryObjectTick.IsValid() && PrimaryObjectTick->IsTickFunctionRegistered())
 		{
-			PrimaryObjectTick.UnRegisterTickFunction();
+			PrimaryObjectTick->UnRegisterTickFunction();
 		}
 	}
 }
@@ -354,23 +525,24 @@ FName FScriptableObjectTickFunction::DiagnosticContext(bool bDetailed)
 //  Data Binding & Context
 // -------------------------------------------------------------------
 
-void UScriptableObject::InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
+void UScriptableObject::InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
 {
-	ContextRef = InContext;
+	ContextScopeRef = InContextScope;
 	BindingsMapRef = InBindingMap;
+	BindingCache.Reset();
 }
 
 void UScriptableObject::PropagateRuntimeData(UScriptableObject* Child) const
 {
 	if (Child)
 	{
-		Child->InitRuntimeData(ContextRef, BindingsMapRef);
+		Child->InitRuntimeData(ContextScopeRef, BindingsMapRef);
 	}
 }
 
 void UScriptableObject::ResolveBindings()
 {
-	PropertyBindings.ResolveBindings(this);
+	PropertyBindings.ResolveBindings(this, &BindingCache);
 }
 
 UScriptableObject* UScriptableObject::FindBindingSource(const FGuid& InID)
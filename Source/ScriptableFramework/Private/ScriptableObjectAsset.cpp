@@ -2,6 +2,23 @@
 
 #include "ScriptableObjectAsset.h"
 #include "UObject/AssetRegistryTagsContext.h"
+#include "Utils/ScriptableContextBuilder.h"
+#include "HAL/IConsoleManager.h"
+
+namespace ScriptableObjectAsset
+{
+	static bool bClusterAssets = false;
+	static FAutoConsoleVariableRef CVarClusterAssets(
+		TEXT("Scriptable.GC.ClusterAssets"),
+		bClusterAssets,
+		TEXT("If true, loaded scriptable assets become GC cluster roots so their nodes are not traced individually.\n")
+		TEXT("Only safe when nothing registers or evaluates the asset's own containers at runtime (see UScriptableObjectAsset::CanBeClusterRoot)."));
+}
+
+bool UScriptableObjectAsset::CanBeClusterRoot() const
+{
+	return ScriptableObjectAsset::bClusterAssets;
+}
 
 #if WITH_EDITOR
 void UScriptableObjectAsset::GetAssetRegistryTags(FAssetRegistryTagsContext RegContext) const
@@ -38,14 +55,18 @@ void UScriptableObjectAsset::RefreshContext()
 {
 	if (FInstancedPropertyBag* ContextRef = GetContext())
 	{
-		ContextRef->Reset();
+		// Declare everything first so the bag is laid out once instead of once per parameter.
+		FScriptableContextBuilder Builder;
 		for (const FScriptableParameterDef& ScriptableParam : Context)
 		{
 			if (ScriptableParam.IsValid())
 			{
-				ContextRef->AddContainerProperty(ScriptableParam.Name, ScriptableParam.ContainerType, ScriptableParam.ValueType, ScriptableParam.ValueTypeObject);
+				Builder.AddContainer(ScriptableParam.Name, ScriptableParam.ContainerType, ScriptableParam.ValueType, ScriptableParam.ValueTypeObject);
 			}
 		}
+
+		ContextRef->Reset();
+		Builder.Apply(*ContextRef);
 	}
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,101 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableObjectRegistry.h"
+#include "ScriptableObject.h"
+#include "ScriptableFramework.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Objects"), STAT_ScriptableRegistry_NumObjects, STATGROUP_ScriptableFramework);
+DECLARE_CYCLE_STAT(TEXT("Registry Teardown"), STAT_ScriptableRegistry_Teardown, STATGROUP_ScriptableFramework);
+
+void UScriptableObjectRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// A single delegate per world, instead of one per registered object.
+	OnWorldBeginTearDownHandle = FWorldDelegates::OnWorldBeginTearDown.AddUObject(this, &UScriptableObjectRegistry::OnWorldBeginTearDown);
+}
+
+void UScriptableObjectRegistry::Deinitialize()
+{
+	FWorldDelegates::OnWorldBeginTearDown.Remove(OnWorldBeginTearDownHandle);
+	UnregisterAll();
+
+	Super::Deinitialize();
+}
+
+bool UScriptableObjectRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Objects register with any world that runs them, including editor and asset preview worlds.
+	return WorldType != EWorldType::None && WorldType != EWorldType::Inactive;
+}
+
+void UScriptableObjectRegistry::AddObject(UScriptableObject* Object)
+{
+	check(Object && Object->RegistryIndex == INDEX_NONE);
+
+	Object->Registry = this;
+	Object->RegistryIndex = RegisteredObjects.Add(Object);
+	INC_DWORD_STAT(STAT_ScriptableRegistry_NumObjects);
+}
+
+void UScriptableObjectRegistry::RemoveObject(UScriptableObject* Object)
+{
+	const int32 Index = Object ? Object->RegistryIndex : INDEX_NONE;
+	if (!RegisteredObjects.IsValidIndex(Index) || RegisteredObjects[Index].GetEvenIfUnreachable() != Object)
+	{
+		return;
+	}
+
+	Object->Registry.Reset();
+	Object->RegistryIndex = INDEX_NONE;
+	RegisteredObjects.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	// Patch the slot of the object that was moved into the hole.
+	if (RegisteredObjects.IsValidIndex(Index))
+	{
+		if (UScriptableObject* Moved = RegisteredObjects[Index].GetEvenIfUnreachable())
+		{
+			Moved->RegistryIndex = Index;
+		}
+	}
+
+	DEC_DWORD_STAT(STAT_ScriptableRegistry_NumObjects);
+}
+
+void UScriptableObjectRegistry::OnWorldBeginTearDown(UWorld* InWorld)
+{
+	if (InWorld == GetWorld())
+	{
+		UnregisterAll();
+	}
+}
+
+void UScriptableObjectRegistry::UnregisterAll()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ScriptableRegistry_Teardown);
+
+	// Take the array so the Unregister calls below don't touch it while iterating.
+	TArray<TWeakObjectPtr<UScriptableObject>> Objects = MoveTemp(RegisteredObjects);
+	RegisteredObjects.Reset();
+	DEC_DWORD_STAT_BY(STAT_ScriptableRegistry_NumObjects, Objects.Num());
+
+	for (const TWeakObjectPtr<UScriptableObject>& WeakObject : Objects)
+	{
+		if (UScriptableObject* Object = WeakObject.Get())
+		{
+			Object->Registry.Reset();
+			Object->RegistryIndex = INDEX_NONE;
+		}
+	}
+
+	// Parents may unregister their children first, those are skipped.
+	for (const TWeakObjectPtr<UScriptableObject>& WeakObject : Objects)
+	{
+		UScriptableObject* Object = WeakObject.Get();
+		if (Object && Object->IsRegistered())
+		{
+			Object->Unregister();
+		}
+	}
+}
@@ -2,6 +2,9 @@
 
 #include "ScriptableTasks/ScriptableAction.h"
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableActionScheduler.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 FScriptableAction::FScriptableAction()
 {
@@ -9,68 +12,116 @@ FScriptableAction::FScriptableAction()
 
 FScriptableAction::~FScriptableAction()
 {
+	// The scheduler queue and the timer manager hold our address, they must not outlive us.
+	CancelScheduledWork();
+	ClearParallelStartTimer();
 }
 
 void FScriptableAction::Register(UObject* InOwner)
 {
 	Super::Register(InOwner);
 
-	// Filter invalid tasks
+	// Filter invalid tasks, and tasks stripped from this build (a cooked build won't have loaded them at all)
 	for (int32 i = Tasks.Num() - 1; i >= 0; --i)
 	{
-		if (!Tasks[i])
+		if (!Tasks[i] || !Tasks[i]->IsIncludedInBuild())
 		{
 			Tasks.RemoveAt(i);
 		}
 	}
 
-	for (UScriptableTask* Task : Tasks)
+	const bool bLazyRegistration = UsesLazyTaskRegistration();
+
+	for (int32 i = 0; i < Tasks.Num(); ++i)
 	{
-		if (Task)
+		// Templates are injected once instantiated, they must not be touched.
+		if (UScriptableTask* Task = Tasks[i]; Task && !IsTaskTemplate(i))
 		{
 			// Add to local map and inject THIS Context into the task
 			AddBindingSource(Task);
 
-			if (Task->IsEnabled())
+			// In lazy mode tasks are registered by BeginSubTask when the sequence reaches them.
+			if (Task->IsEnabled() && !bLazyRegistration)
 			{
 				Task->Register(Owner);
 			}
 		}
 	}
+
+	TaskNodeRuntime.SetNum(TaskNodes.Num());
+	for (int32 i = 0; i < TaskNodes.Num(); ++i)
+	{
+		const FScriptableTaskNode* Node = TaskNodes[i].GetPtr<FScriptableTaskNode>();
+		const UScriptStruct* InstanceDataType = Node ? Node->GetInstanceDataType() : nullptr;
+		TaskNodeRuntime[i].InstanceData.InitializeAs(InstanceDataType);
+	}
+
+	bIsRegistered = true;
 }
 
 void FScriptableAction::Unregister()
 {
-	for (UScriptableTask* Task : Tasks)
+	CancelScheduledWork();
+	ClearParallelStartTimer();
+
+	for (int32 i = 0; i < Tasks.Num(); ++i)
 	{
-		if (Task && Task->IsEnabled())
+		UScriptableTask* Task = Tasks[i];
+		if (!Task || IsTaskTemplate(i))
+		{
+			continue;
+		}
+
+		// Lazily registered tasks may never have been reached, or were already released after their run.
+		if (Task->IsRegistered())
 		{
 			Task->Unregister();
 		}
+
+		Task->ClearDelegates();
 	}
 
+	TaskNodeRuntime.Reset();
+
+	bIsRegistered = false;
 	Super::Unregister();
 }
 
 void FScriptableAction::Reset()
 {
 	// Reset logic state
+	CancelScheduledWork();
+	ClearParallelStartTimer();
 	bIsRunning = false;
 	CurrentTaskIndex = 0;
 
 	// Propagate hard reset to all tasks
-	for (UScriptableTask* Task : Tasks)
+	for (int32 i = 0; i < Tasks.Num(); ++i)
 	{
-		if (Task)
+		if (Tasks[i] && !IsTaskTemplate(i))
 		{
-			Task->Reset();
+			Tasks[i]->Reset();
+		}
+	}
+
+	ResetTaskNodeRuntime();
+}
+
+void FScriptableAction::ResetTaskNodeRuntime()
+{
+	for (FScriptableTaskNodeRuntime& Runtime : TaskNodeRuntime)
+	{
+		Runtime.bRunning = false;
+		if (Runtime.InstanceData.IsValid())
+		{
+			Runtime.InstanceData.InitializeAs(Runtime.InstanceData.GetScriptStruct());
 		}
 	}
 }
 
 void FScriptableAction::Begin()
 {
-	if (Tasks.IsEmpty())
+	if (GetNumTasks() == 0)
 	{
 		bIsRunning = false;
 		return;
@@ -79,68 +130,347 @@ void FScriptableAction::Begin()
 	bIsRunning = true;
 	CurrentTaskIndex = 0;
 
-	if (Mode == EScriptableActionMode::Sequence)
+	if (!TrySchedule(EScriptableScheduledWork::Begin))
 	{
-		BeginSubTask(Tasks[CurrentTaskIndex]);
+		BeginImmediate();
 	}
-	else if (Mode == EScriptableActionMode::Parallel)
+}
+
+void FScriptableAction::Restart()
+{
+	if (!ensureMsgf(bIsRegistered, TEXT("Restart requires a registered action.")))
+	{
+		return;
+	}
+
+	if (bIsRunning)
+	{
+		Finish();
+	}
+
+	// Soft reset: unlike Reset(), this doesn't call ResetTask or clear DoOnce state.
+	CurrentTaskIndex = 0;
+	for (int32 i = 0; i < Tasks.Num(); ++i)
 	{
-		for (UScriptableTask* Task : Tasks)
+		if (Tasks[i] && !IsTaskTemplate(i))
 		{
-			BeginSubTask(Task);
+			Tasks[i]->ResetRuntimeState();
 		}
 	}
 
+	ResetTaskNodeRuntime();
+
+	Begin();
+}
+
+void FScriptableAction::BeginImmediate()
+{
+	if (Mode == EScriptableActionMode::Sequence)
+	{
+		BeginSubTask(CurrentTaskIndex);
+	}
+	else if (Mode == EScriptableActionMode::Parallel)
+	{
+		NextParallelTaskIndex = 0;
+		BeginParallelBatch();
+	}
+
 	OnActionBegin.Broadcast();
 }
 
+void FScriptableAction::BeginParallelBatch()
+{
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+
+	// Without a world there is no next frame to defer to, so begin everything now.
+	const int32 NumTasks = GetNumTasks();
+	const int32 BatchSize = World ? GetParallelBatchSize() : NumTasks;
+	const int32 EndIndex = FMath::Min(NumTasks, NextParallelTaskIndex + BatchSize);
+
+	while (bIsRunning && NextParallelTaskIndex < EndIndex)
+	{
+		BeginSubTask(NextParallelTaskIndex++);
+	}
+
+	if (bIsRunning && NextParallelTaskIndex < NumTasks)
+	{
+		// Bound to the owner so the timer dies with it; the destructor clears it if the action goes first.
+		PendingWork.TimerWorld = World;
+		PendingWork.ParallelStartTimerHandle = World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(Owner.Get(), [this]()
+		{
+			PendingWork.ParallelStartTimerHandle.Invalidate();
+
+			if (bIsRegistered && bIsRunning)
+			{
+				BeginParallelBatch();
+			}
+		}));
+	}
+}
+
+int32 FScriptableAction::GetParallelBatchSize() const
+{
+	int32 BatchSize = GetNumTasks();
+
+	if (StartupFrameSpread > 1)
+	{
+		BatchSize = FMath::DivideAndRoundUp(GetNumTasks(), StartupFrameSpread);
+	}
+
+	if (MaxTaskStartsPerFrame > 0)
+	{
+		BatchSize = FMath::Min(BatchSize, MaxTaskStartsPerFrame);
+	}
+
+	return FMath::Max(1, BatchSize);
+}
+
+void FScriptableAction::ClearParallelStartTimer()
+{
+	if (!PendingWork.ParallelStartTimerHandle.IsValid())
+	{
+		return;
+	}
+
+	// Resolved through the cached world: this also runs from the destructor, where Owner may already be gone.
+	if (UWorld* World = PendingWork.TimerWorld.Get())
+	{
+		World->GetTimerManager().ClearTimer(PendingWork.ParallelStartTimerHandle);
+	}
+
+	PendingWork.ParallelStartTimerHandle.Invalidate();
+	PendingWork.TimerWorld.Reset();
+}
+
 void FScriptableAction::Finish()
 {
 	if (!bIsRunning) return;
 
-	for (UScriptableTask* Task : Tasks)
+	CancelScheduledWork();
+	ClearParallelStartTimer();
+
+	for (int32 i = 0; i < Tasks.Num(); ++i)
 	{
-		if (Task)
+		if (UScriptableTask* Task = Tasks[i]; Task && !IsTaskTemplate(i))
 		{
-			Task->OnTaskFinishNative.RemoveAll(this);
+			// Detach first so the forced finish doesn't re-enter OnSubTaskFinished.
+			Task->ParentAction = nullptr;
 			Task->Finish();
+
+			if (UsesLazyTaskRegistration() && Task->IsRegistered())
+			{
+				Task->Unregister();
+			}
 		}
 	}
 
+	for (int32 i = 0; i < TaskNodeRuntime.Num(); ++i)
+	{
+		FinishTaskNode(i, true);
+	}
+
 	bIsRunning = false;
 	CurrentTaskIndex = 0;
 
 	OnActionFinish.Broadcast();
 }
 
-void FScriptableAction::BeginSubTask(UScriptableTask* Task)
+void FScriptableAction::BeginSubTask(int32 TaskIndex)
 {
+	if (TaskIndex >= Tasks.Num())
+	{
+		BeginTaskNode(TaskIndex - Tasks.Num());
+		return;
+	}
+
+	UScriptableTask* Task = Tasks[TaskIndex];
 	if (!Task || !Task->IsEnabled())
 	{
 		OnSubTaskFinished(Task);
 		return;
 	}
 
-	Task->OnTaskFinishNative.RemoveAll(this);
-	Task->OnTaskFinishNative.AddRaw(this, &FScriptableAction::OnSubTaskFinished);
+	if (IsTaskTemplate(TaskIndex))
+	{
+		Task = InstantiateTask(TaskIndex);
+	}
+
+	if (!Task->IsRegistered())
+	{
+		// Lazy registration: re-inject the context (cleared on Unregister) and register just in time.
+		AddBindingSource(Task);
+		Task->Register(Owner);
+
+		if (!Task->IsRegistered())
+		{
+			OnSubTaskFinished(Task);
+			return;
+		}
+	}
+
+	Task->ParentAction = this;
 	Task->Begin();
 }
 
+void FScriptableAction::SetLazyTaskOuter(UObject* Outer)
+{
+	ensureMsgf(!Outer || UsesLazyTaskRegistration(), TEXT("Tasks can only be instantiated on first use with lazy task registration."));
+	LazyTaskOuter = Outer;
+}
+
+bool FScriptableAction::IsTaskTemplate(int32 Index) const
+{
+	const UScriptableTask* Task = Tasks.IsValidIndex(Index) ? Tasks[Index].Get() : nullptr;
+	return LazyTaskOuter && Task && Task->GetOuter() != LazyTaskOuter;
+}
+
+UScriptableTask* FScriptableAction::InstantiateTask(int32 TaskIndex)
+{
+	UScriptableTask* Task = UScriptableObject::DuplicateForRuntime<UScriptableTask>(Tasks[TaskIndex], LazyTaskOuter);
+	Tasks[TaskIndex] = Task;
+	return Task;
+}
+
 void FScriptableAction::OnSubTaskFinished(UScriptableTask* Task)
 {
-	if (Task)
+	// Lazy registration: the task is done, release its world registration right away.
+	// Its properties stay readable through the binding map for later sibling bindings.
+	if (Task && Task->IsRegistered() && UsesLazyTaskRegistration())
 	{
-		Task->OnTaskFinishNative.RemoveAll(this);
+		Task->Unregister();
 	}
 
 	// In Parallel mode CurrentTaskIndex acts as a counter
-	if (++CurrentTaskIndex >= Tasks.Num())
+	if (++CurrentTaskIndex >= GetNumTasks())
 	{
 		Finish();
 	}
 	else if (Mode == EScriptableActionMode::Sequence)
 	{
-		BeginSubTask(Tasks[CurrentTaskIndex]);
+		if (!TrySchedule(EScriptableScheduledWork::SequenceStep))
+		{
+			BeginSubTask(CurrentTaskIndex);
+		}
+	}
+}
+
+void FScriptableAction::BeginTaskNode(int32 NodeIndex)
+{
+	const FScriptableTaskNode* Node = TaskNodes[NodeIndex].GetPtr<FScriptableTaskNode>();
+	if (!Node || !TaskNodeRuntime.IsValidIndex(NodeIndex))
+	{
+		OnSubTaskFinished(nullptr);
+		return;
+	}
+
+	FScriptableTaskNodeRuntime& Runtime = TaskNodeRuntime[NodeIndex];
+	Runtime.bRunning = true;
+	++Runtime.RunSerial;
+
+	if (Node->Begin(MakeTaskNodeContext(NodeIndex)) == EScriptableTaskNodeResult::Finished)
+	{
+		FinishTaskNode(NodeIndex, false);
+	}
+}
+
+void FScriptableAction::FinishTaskNode(int32 NodeIndex, bool bForced)
+{
+	FScriptableTaskNodeRuntime& Runtime = TaskNodeRuntime[NodeIndex];
+	if (!Runtime.bRunning)
+	{
+		return;
+	}
+
+	Runtime.bRunning = false;
+
+	if (const FScriptableTaskNode* Node = TaskNodes[NodeIndex].GetPtr<FScriptableTaskNode>())
+	{
+		Node->Finish(MakeTaskNodeContext(NodeIndex));
+	}
+
+	if (!bForced)
+	{
+		OnSubTaskFinished(nullptr);
+	}
+}
+
+FScriptableTaskNodeContext FScriptableAction::MakeTaskNodeContext(int32 NodeIndex)
+{
+	FScriptableTaskNodeRuntime& Runtime = TaskNodeRuntime[NodeIndex];
+
+	FScriptableTaskNodeContext NodeContext;
+	NodeContext.Owner = Owner;
+	NodeContext.Context = GetEffectiveContext();
+	NodeContext.InstanceData = FStructView(Runtime.InstanceData);
+	NodeContext.Handle.Action = this;
+	NodeContext.Handle.Owner = Owner;
+	NodeContext.Handle.NodeIndex = NodeIndex;
+	NodeContext.Handle.RunSerial = Runtime.RunSerial;
+	return NodeContext;
+}
+
+void FScriptableTaskNodeHandle::Finish() const
+{
+	if (!IsValid() || Action->Owner != Owner.Get() || !Action->TaskNodeRuntime.IsValidIndex(NodeIndex))
+	{
+		return;
+	}
+
+	if (Action->TaskNodeRuntime[NodeIndex].RunSerial == RunSerial)
+	{
+		Action->FinishTaskNode(NodeIndex, false);
+	}
+}
+
+bool FScriptableAction::TrySchedule(EScriptableScheduledWork Work)
+{
+	if (!bTimeSliced)
+	{
+		return false;
+	}
+
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	UScriptableActionScheduler* Scheduler = World ? World->GetSubsystem<UScriptableActionScheduler>() : nullptr;
+	if (!Scheduler)
+	{
+		// No scheduler (e.g. editor preview worlds), run inline.
+		return false;
+	}
+
+	Scheduler->Enqueue(*this, Work);
+	PendingWork.Scheduler = Scheduler;
+	return true;
+}
+
+void FScriptableAction::CancelScheduledWork()
+{
+	// Resolved through the cached pointer: this also runs from the destructor, where Owner may already be gone.
+	if (UScriptableActionScheduler* Scheduler = PendingWork.Scheduler.Get())
+	{
+		Scheduler->Cancel(*this);
+	}
+
+	PendingWork.Scheduler.Reset();
+}
+
+void FScriptableAction::ExecuteScheduledWork(EScriptableScheduledWork Work)
+{
+	PendingWork.Scheduler.Reset();
+
+	if (!bIsRunning)
+	{
+		return;
+	}
+
+	switch (Work)
+	{
+		case EScriptableScheduledWork::Begin:
+		BeginImmediate();
+		break;
+
+		case EScriptableScheduledWork::SequenceStep:
+		BeginSubTask(CurrentTaskIndex);
+		break;
 	}
 }
 
@@ -148,6 +478,12 @@ void FScriptableAction::RunAction(UObject* Owner, FScriptableAction& Action)
 {
 	if (!Owner) return;
 
+	if (Action.IsRegistered() && Action.Owner == Owner)
+	{
+		Action.Restart();
+		return;
+	}
+
 	if (Action.IsRunning())
 	{
 		Action.Finish();
@@ -2,6 +2,7 @@
 
 #include "ScriptableTasks/ScriptableActionAsset.h"
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableActionPool.h"
 
 #include "Algo/AnyOf.h"
 
@@ -9,7 +10,8 @@ void UScriptableTask_RunAsset::OnRegister()
 {
 	Super::OnRegister();
 
-	if (!RuntimeAction.IsRunning())
+	const FScriptableAction* RuntimeAction = GetRuntimeAction();
+	if (!RuntimeAction || !RuntimeAction->IsRunning())
 	{
 		InstantiateRuntimeAction();
 	}
@@ -23,19 +25,33 @@ void UScriptableTask_RunAsset::OnUnregister()
 
 void UScriptableTask_RunAsset::ResetTask()
 {
-	if (RuntimeAction.IsRunning())
+	if (FScriptableAction* RuntimeAction = GetRuntimeAction(); RuntimeAction && RuntimeAction->IsRunning())
 	{
-		RuntimeAction.Finish();
+		RuntimeAction->Finish();
 	}
 
-	InstantiateRuntimeAction();
+	// Pooled copies are reset while unregistered; they get a runtime action on their next registration.
+	if (IsRegistered())
+	{
+		InstantiateRuntimeAction();
+	}
 }
 
 void UScriptableTask_RunAsset::BeginTask()
 {
-	if (Asset && !RuntimeAction.Tasks.IsEmpty())
+	FScriptableAction* RuntimeAction = GetRuntimeAction();
+	if ((Asset || bHasInlinedAction) && (!RuntimeAction || !RuntimeAction->IsRegistered()))
+	{
+		InstantiateRuntimeAction();
+		RuntimeAction = GetRuntimeAction();
+	}
+
+	if (RuntimeAction && RuntimeAction->GetNumTasks() > 0)
 	{
-		RuntimeAction.Begin();
+		// The runtime action stays registered between runs, so loops and re-runs take the warm path.
+		// Parameters are refreshed from the caller's scope on every run.
+		RuntimeAction->PullContextFromParent();
+		RuntimeAction->Restart();
 	}
 	else
 	{
@@ -45,52 +61,91 @@ void UScriptableTask_RunAsset::BeginTask()
 
 void UScriptableTask_RunAsset::FinishTask()
 {
-	// Ensure the inner action is stopped properly
-	RuntimeAction.Finish();
-	RuntimeAction.Unregister();
+	// Ensure the inner action is stopped properly.
+	// It is kept registered until this task unregisters.
+	if (FScriptableAction* RuntimeAction = GetRuntimeAction())
+	{
+		RuntimeAction->Finish();
+	}
 }
 
 void UScriptableTask_RunAsset::InstantiateRuntimeAction()
 {
 	TeardownRuntimeAction();
 
-	if (Asset)
+	if (Asset || bHasInlinedAction)
 	{
-		// Copy the Struct
-		RuntimeAction = Asset->Action;
-
-		if (const FInstancedPropertyBag* ParentContext = GetContext())
+		// Cooked hosts carry their own copy, nothing to acquire.
+		if (!bHasInlinedAction)
 		{
-			RuntimeAction.Context = *ParentContext;
+			RuntimeInstance = UScriptableActionPool::AcquireInstance(GetWorld(), Asset, this);
 		}
 
-		// Deep Copy Tasks
-		// The 'Tasks' array currently points to the Asset's archetype objects.
-		for (int32 i = 0; i < RuntimeAction.Tasks.Num(); ++i)
-		{
-			UScriptableTask* TemplateTask = RuntimeAction.Tasks[i];
-			if (TemplateTask)
-			{
-				UScriptableTask* NewTaskInstance = DuplicateObject<UScriptableTask>(TemplateTask, this);
-				RuntimeAction.Tasks[i] = NewTaskInstance;
-			}
-		}
+		FScriptableAction& RuntimeAction = *GetRuntimeAction();
+
+		// The runtime action keeps the asset's declared Context and layers it on top of ours, instead of copying our bag.
+		RuntimeAction.SetParentScope(GetContextScope());
 
+		RuntimeAction.OnActionFinish.AddUObject(this, &UScriptableTask_RunAsset::OnRuntimeActionFinished);
 		RuntimeAction.Register(GetOwner());
+		RuntimeAction.PullContextFromParent();
 	}
 }
 
 void UScriptableTask_RunAsset::TeardownRuntimeAction()
 {
-	if (RuntimeAction.IsRunning())
+	FScriptableAction* RuntimeAction = GetRuntimeAction();
+	if (!RuntimeAction || (bHasInlinedAction && !RuntimeAction->IsRegistered()))
 	{
-		RuntimeAction.Finish();
+		return;
 	}
 
-	RuntimeAction.Unregister();
+	RuntimeAction->OnActionFinish.RemoveAll(this);
 
-	// Explicitly empty tasks to drop references to the instanced objects
-	RuntimeAction.Tasks.Empty();
+	if (RuntimeAction->IsRunning())
+	{
+		RuntimeAction->Finish();
+	}
+
+	RuntimeAction->Unregister();
+
+	if (bHasInlinedAction)
+	{
+		// Same reset the pool does on release.
+		InlinedAction.Reset();
+		InlinedAction.Context.CopyMatchingValuesByID(InlinedContextDefaults);
+		return;
+	}
+
+	// Hand the instance back instead of dropping its tasks for the GC.
+	UScriptableActionPool::ReleaseInstance(GetWorld(), RuntimeInstance);
+	RuntimeInstance = nullptr;
+}
+
+void UScriptableTask_RunAsset::InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
+{
+	Super::InitRuntimeData(InContextScope, InBindingMap);
+
+	// The runtime action layers its Context on top of our scope, keep it in sync.
+	if (FScriptableAction* RuntimeAction = GetRuntimeAction())
+	{
+		RuntimeAction->UpdateParentScope(GetContextScope());
+	}
+}
+
+FScriptableAction* UScriptableTask_RunAsset::GetRuntimeAction() const
+{
+	if (bHasInlinedAction)
+	{
+		return const_cast<FScriptableAction*>(&InlinedAction);
+	}
+
+	return RuntimeInstance ? &RuntimeInstance->Action : nullptr;
+}
+
+void UScriptableTask_RunAsset::OnRuntimeActionFinished()
+{
+	Finish();
 }
 
 #if WITH_EDITOR
@@ -98,4 +153,38 @@ FText UScriptableTask_RunAsset::GetDisplayTitle() const
 {
 	return Asset ? FText::FromString(Asset->GetName()) : INVTEXT("None");
 }
+
+void UScriptableTask_RunAsset::InlineReferencedAssets(TArray<const UObject*>& AssetStack)
+{
+	// Recursive references keep the runtime path.
+	if (!Asset || bHasInlinedAction || AssetStack.Contains(Asset))
+	{
+		return;
+	}
+
+	InlinedAction = Asset->Action;
+	InlinedContextDefaults = Asset->Action.Context;
+
+	// Plain duplication: these copies are saved, so they must keep their own binding lists.
+	for (TObjectPtr<UScriptableTask>& Task : InlinedAction.Tasks)
+	{
+		if (Task)
+		{
+			Task = DuplicateObject<UScriptableTask>(Task, this);
+		}
+	}
+
+	bHasInlinedAction = true;
+
+	// Self-contained from here on, the cooked task doesn't need (or load) the asset.
+	const UScriptableActionAsset* InlinedAsset = Asset;
+	Asset = nullptr;
+
+	AssetStack.Push(InlinedAsset);
+	for (UScriptableTask* Task : InlinedAction.Tasks)
+	{
+		InlineReferencedAssetsInHierarchy(Task, AssetStack);
+	}
+	AssetStack.Pop();
+}
 #endif
\ No newline at end of file
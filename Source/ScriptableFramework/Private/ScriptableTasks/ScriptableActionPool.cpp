@@ -0,0 +1,170 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTasks/ScriptableActionPool.h"
+#include "ScriptableTasks/ScriptableActionAsset.h"
+#include "ScriptableTasks/ScriptableTask.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace ScriptableActionPool
+{
+	static int32 MaxFreePerAsset = 16;
+	static FAutoConsoleVariableRef CVarMaxFreePerAsset(
+		TEXT("Scriptable.ActionPool.MaxFreePerAsset"),
+		MaxFreePerAsset,
+		TEXT("Maximum number of free action instances kept per asset. An asset's PoolPrewarmCount raises it for that asset."));
+
+	static FAutoConsoleCommandWithWorld CmdTrim(
+		TEXT("Scriptable.ActionPool.Trim"),
+		TEXT("Drops all free action instances pooled in the current world."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UScriptableActionPool* Pool = World ? World->GetSubsystem<UScriptableActionPool>() : nullptr)
+			{
+				Pool->Trim();
+			}
+		}));
+}
+
+// -------------------------------------------------------------------
+//  UScriptableActionInstance
+// -------------------------------------------------------------------
+
+UScriptableActionInstance* UScriptableActionInstance::Create(UObject* Outer, const UScriptableActionAsset* InAsset)
+{
+	check(InAsset);
+
+	UScriptableActionInstance* Instance = NewObject<UScriptableActionInstance>(Outer, NAME_None, RF_Transient);
+	Instance->Asset = InAsset;
+
+	// Copy the Struct
+	Instance->Action = InAsset->Action;
+
+	// Lazily registered sequences only instantiate the tasks they actually reach.
+	if (Instance->Action.UsesLazyTaskRegistration())
+	{
+		Instance->Action.SetLazyTaskOuter(Instance);
+		return Instance;
+	}
+
+	// Deep Copy Tasks
+	// The 'Tasks' array currently points to the Asset's archetype objects.
+	for (TObjectPtr<UScriptableTask>& Task : Instance->Action.Tasks)
+	{
+		if (Task)
+		{
+			Task = UScriptableObject::DuplicateForRuntime<UScriptableTask>(Task, Instance);
+		}
+	}
+
+	return Instance;
+}
+
+// -------------------------------------------------------------------
+//  UScriptableActionPool
+// -------------------------------------------------------------------
+
+void UScriptableActionPool::Deinitialize()
+{
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+void UScriptableActionPool::Prewarm(const UScriptableActionAsset* Asset, int32 Count)
+{
+	if (!Asset)
+	{
+		return;
+	}
+
+	FScriptableActionInstanceList& Pool = Pools.FindOrAdd(Asset);
+	Pool.FreeInstances.Reserve(Count);
+
+	while (Pool.FreeInstances.Num() < Count)
+	{
+		Pool.FreeInstances.Add(UScriptableActionInstance::Create(this, Asset));
+	}
+}
+
+UScriptableActionInstance* UScriptableActionPool::Acquire(const UScriptableActionAsset* Asset)
+{
+	check(Asset);
+
+	FScriptableActionInstanceList& Pool = Pools.FindOrAdd(Asset);
+
+	if (!Pool.bPrewarmed)
+	{
+		Pool.bPrewarmed = true;
+		Prewarm(Asset, Asset->PoolPrewarmCount);
+	}
+
+	if (!Pool.FreeInstances.IsEmpty())
+	{
+		return Pool.FreeInstances.Pop(EAllowShrinking::No);
+	}
+
+	return UScriptableActionInstance::Create(this, Asset);
+}
+
+void UScriptableActionPool::Release(UScriptableActionInstance* Instance)
+{
+	if (!Instance || !Instance->Asset)
+	{
+		return;
+	}
+
+	FScriptableAction& Action = Instance->Action;
+	ensureMsgf(!Action.IsRegistered(), TEXT("Released action instances must be unregistered first."));
+
+	// Cheap reset: clears task status, loop and DoOnce state, and gives tasks a chance to reset their own state.
+	Action.Reset();
+	Action.Context.CopyMatchingValuesByID(Instance->Asset->Action.Context); // Drop values pulled from the last caller.
+	Action.OnActionBegin.Clear();
+	Action.OnActionFinish.Clear();
+
+	FScriptableActionInstanceList& Pool = Pools.FindOrAdd(Instance->Asset);
+	const int32 MaxFree = FMath::Max(ScriptableActionPool::MaxFreePerAsset, Instance->Asset->PoolPrewarmCount);
+	if (Pool.FreeInstances.Num() < MaxFree)
+	{
+		Pool.FreeInstances.Add(Instance);
+	}
+}
+
+void UScriptableActionPool::Trim()
+{
+	for (TPair<TObjectPtr<const UScriptableActionAsset>, FScriptableActionInstanceList>& Pair : Pools)
+	{
+		Pair.Value.FreeInstances.Empty();
+	}
+}
+
+int32 UScriptableActionPool::GetNumFree(const UScriptableActionAsset* Asset) const
+{
+	const FScriptableActionInstanceList* Pool = Pools.Find(Asset);
+	return Pool ? Pool->FreeInstances.Num() : 0;
+}
+
+UScriptableActionInstance* UScriptableActionPool::AcquireInstance(UWorld* World, const UScriptableActionAsset* Asset, UObject* FallbackOuter)
+{
+	if (UScriptableActionPool* Pool = World ? World->GetSubsystem<UScriptableActionPool>() : nullptr)
+	{
+		return Pool->Acquire(Asset);
+	}
+
+	return UScriptableActionInstance::Create(FallbackOuter, Asset);
+}
+
+void UScriptableActionPool::ReleaseInstance(UWorld* World, UScriptableActionInstance* Instance)
+{
+	if (!Instance)
+	{
+		return;
+	}
+
+	UScriptableActionPool* Pool = World ? World->GetSubsystem<UScriptableActionPool>() : nullptr;
+	if (Pool && Instance->GetOuter() == Pool)
+	{
+		Pool->Release(Instance);
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTasks/ScriptableActionScheduler.h"
+#include "ScriptableFramework.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Action Scheduler Tick"), STAT_ScriptableScheduler_Tick, STATGROUP_ScriptableFramework);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Action Scheduler Queue Depth"), STAT_ScriptableScheduler_QueueDepth, STATGROUP_ScriptableFramework);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Action Scheduler Max Latency (ms)"), STAT_ScriptableScheduler_MaxLatency, STATGROUP_ScriptableFramework);
+
+namespace ScriptableActionScheduler
+{
+	static float BudgetMs = 2.0f;
+	static FAutoConsoleVariableRef CVarBudgetMs(
+		TEXT("Scriptable.Scheduler.BudgetMs"),
+		BudgetMs,
+		TEXT("Time budget per frame, in milliseconds, for executing time-sliced scriptable actions."));
+}
+
+void UScriptableActionScheduler::Deinitialize()
+{
+	Queue.Empty();
+	Stats = FScriptableActionSchedulerStats();
+
+	Super::Deinitialize();
+}
+
+TStatId UScriptableActionScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UScriptableActionScheduler, STATGROUP_Tickables);
+}
+
+void UScriptableActionScheduler::Enqueue(FScriptableAction& Action, EScriptableScheduledWork Work)
+{
+	FScheduledItem Item;
+	Item.Action = &Action;
+	Item.Owner = Action.Owner;
+	Item.Work = Work;
+	Item.Priority = Action.SchedulePriority;
+	Item.Serial = NextSerial++;
+	Item.EnqueueTime = FPlatformTime::Seconds();
+
+	Queue.HeapPush(Item, FScheduledItemPredicate());
+	Stats.QueueDepth = Queue.Num();
+}
+
+void UScriptableActionScheduler::Cancel(const FScriptableAction& Action)
+{
+	if (Queue.RemoveAll([&Action](const FScheduledItem& Item) { return Item.Action == &Action; }) > 0)
+	{
+		Queue.Heapify(FScheduledItemPredicate());
+		Stats.QueueDepth = Queue.Num();
+	}
+}
+
+void UScriptableActionScheduler::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ScriptableScheduler_Tick);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = FMath::Max(0.f, ScriptableActionScheduler::BudgetMs) / 1000.0;
+
+	int32 Processed = 0;
+	double MaxLatency = 0.0;
+
+	while (!Queue.IsEmpty())
+	{
+		const double Now = FPlatformTime::Seconds();
+
+		// Always run at least one item per frame so the queue keeps moving with a zero budget.
+		if (Processed > 0 && Now - StartTime >= Budget)
+		{
+			break;
+		}
+
+		FScheduledItem Item;
+		Queue.HeapPop(Item, FScheduledItemPredicate(), EAllowShrinking::No);
+
+		if (!Item.Owner.IsValid())
+		{
+			continue;
+		}
+
+		const double Latency = Now - Item.EnqueueTime;
+		MaxLatency = FMath::Max(MaxLatency, Latency);
+		Stats.AverageLatencyMs = FMath::Lerp(Stats.AverageLatencyMs, float(Latency * 1000.0), 0.1f);
+
+		// Executing may queue more work (e.g. the next Sequence step) or cancel pending items.
+		Item.Action->ExecuteScheduledWork(Item.Work);
+		++Processed;
+	}
+
+	Stats.QueueDepth = Queue.Num();
+	Stats.ProcessedLastFrame = Processed;
+	Stats.TimeSpentLastFrameMs = float((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Stats.MaxLatencyLastFrameMs = float(MaxLatency * 1000.0);
+
+	SET_DWORD_STAT(STAT_ScriptableScheduler_QueueDepth, Stats.QueueDepth);
+	SET_FLOAT_STAT(STAT_ScriptableScheduler_MaxLatency, Stats.MaxLatencyLastFrameMs);
+}
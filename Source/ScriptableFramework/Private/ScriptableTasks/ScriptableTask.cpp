@@ -1,6 +1,7 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableAction.h"
 
 DEFINE_LOG_CATEGORY(LogScriptableTask);
 
@@ -8,6 +9,11 @@ void UScriptableTask::OnUnregister()
 {
 	Super::OnUnregister();
 
+	ParentAction = nullptr;
+}
+
+void UScriptableTask::ClearDelegates()
+{
 	OnTaskBeginNative.Clear();
 	OnTaskFinishNative.Clear();
 	OnTaskBegin.Clear();
@@ -25,6 +31,15 @@ void UScriptableTask::Reset()
 	}
 }
 
+void UScriptableTask::ResetRuntimeState()
+{
+	if (!HasBegun())
+	{
+		Status = EScriptableTaskStatus::None;
+		CurrentLoopIndex = 0;
+	}
+}
+
 void UScriptableTask::Begin()
 {
 	check(bRegistered);
@@ -33,8 +48,7 @@ void UScriptableTask::Begin()
 	{
 		// We treat it as if it started and immediately finished successfully.
 		// This ensures the Action sequence proceeds to the next task.
-		OnTaskFinishNative.Broadcast(this);
-		OnTaskFinish.Broadcast(this);
+		NotifyFinished();
 		return;
 	}
 
@@ -48,8 +62,16 @@ void UScriptableTask::Begin()
 	RegisterTickFunctions(true);
 	BeginTask();
 
-	OnTaskBeginNative.Broadcast(this);
-	OnTaskBegin.Broadcast(this);
+	// External listeners only. Parent actions don't need to know when a task begins.
+	if (OnTaskBeginNative.IsBound())
+	{
+		OnTaskBeginNative.Broadcast(this);
+	}
+
+	if (OnTaskBegin.IsBound())
+	{
+		OnTaskBegin.Broadcast(this);
+	}
 }
 
 void UScriptableTask::Finish()
@@ -81,9 +103,28 @@ void UScriptableTask::Finish()
 		RegisterTickFunctions(false);
 		FinishTask();
 
+		NotifyFinished();
+	}
+}
+
+void UScriptableTask::NotifyFinished()
+{
+	if (OnTaskFinishNative.IsBound())
+	{
 		OnTaskFinishNative.Broadcast(this);
+	}
+
+	if (OnTaskFinish.IsBound())
+	{
 		OnTaskFinish.Broadcast(this);
 	}
+
+	// The parent is notified last, since it may immediately begin the next task or finish the whole action.
+	if (FScriptableAction* Parent = ParentAction)
+	{
+		ParentAction = nullptr;
+		Parent->OnSubTaskFinished(this);
+	}
 }
 
 void UScriptableTask::ResetTask()
@@ -6,6 +6,12 @@
 // Define a static log category for the framework logic
 DEFINE_LOG_CATEGORY_STATIC(LogScriptableLogic, Log, All);
 
+UScriptableTask_LogMessage::UScriptableTask_LogMessage()
+{
+	// Debug output never ships.
+	bDevelopmentOnly = true;
+}
+
 void UScriptableTask_LogMessage::BeginTask()
 {
 	if (bPrintToLog)
@@ -24,6 +30,7 @@ void UScriptableTask_LogMessage::BeginTask()
 		}
 	}
 
+#if !UE_BUILD_SHIPPING
 	if (bPrintToScreen && GEngine)
 	{
 		FColor DisplayColor = TextColor;
@@ -37,6 +44,7 @@ void UScriptableTask_LogMessage::BeginTask()
 
 		GEngine->AddOnScreenDebugMessage(-1, Duration, DisplayColor, Message);
 	}
+#endif
 
 	Finish();
 }
@@ -0,0 +1,143 @@
+// Copyright 2026 kirzo
+
+#include "Utils/ScriptableContextBagPool.h"
+#include "ScriptableFramework.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Context Bags"), STAT_ScriptableContextBagPool_NumPooled, STATGROUP_ScriptableFramework);
+
+namespace ScriptableContextBagPool
+{
+	static int32 MaxBagsPerLayout = 32;
+	static FAutoConsoleVariableRef CVarMaxBagsPerLayout(
+		TEXT("Scriptable.ContextPool.MaxBagsPerLayout"),
+		MaxBagsPerLayout,
+		TEXT("Maximum number of released Context bags kept per layout for reuse. 0 disables pooling."));
+
+	static FAutoConsoleCommand CmdTrim(
+		TEXT("Scriptable.ContextPool.Trim"),
+		TEXT("Frees all pooled Context bag memory."),
+		FConsoleCommandDelegate::CreateStatic(&FScriptableContextBagPool::Trim));
+
+	static TUniquePtr<FScriptableContextBagPool> Instance;
+}
+
+void FScriptableContextBagPool::Startup()
+{
+	ScriptableContextBagPool::Instance = MakeUnique<FScriptableContextBagPool>();
+}
+
+void FScriptableContextBagPool::Shutdown()
+{
+	Trim();
+	ScriptableContextBagPool::Instance.Reset();
+}
+
+FScriptableContextBagPool* FScriptableContextBagPool::Get()
+{
+	check(IsInGameThread());
+	return ScriptableContextBagPool::Instance.Get();
+}
+
+void FScriptableContextBagPool::CopyFrom(FInstancedPropertyBag& Target, const FInstancedPropertyBag& Source)
+{
+	const UPropertyBag* Layout = Source.GetPropertyBagStruct();
+	if (!Layout)
+	{
+		Release(Target);
+		return;
+	}
+
+	if (Target.GetPropertyBagStruct() != Layout)
+	{
+		Release(Target);
+
+		FScriptableContextBagPool* Pool = Get();
+		if (!Pool || !Pool->Pop(Layout, Target))
+		{
+			// Nothing to recycle, regular copy.
+			Target = Source;
+			return;
+		}
+	}
+
+	// Same layout: copy the values over the existing memory.
+	Layout->CopyScriptStruct(Target.GetMutableValue().GetMemory(), Source.GetValue().GetMemory());
+}
+
+void FScriptableContextBagPool::Release(FInstancedPropertyBag& Bag)
+{
+	const UPropertyBag* Layout = Bag.GetPropertyBagStruct();
+	FScriptableContextBagPool* Pool = Layout ? Get() : nullptr;
+
+	if (Pool)
+	{
+		// Only add a key once a bag is actually pooled, a disabled or full pool must not leave empty entries behind.
+		TArray<FInstancedPropertyBag>* Bags = Pool->FreeBags.Find(Layout);
+		const int32 NumBags = Bags ? Bags->Num() : 0;
+		if (NumBags < ScriptableContextBagPool::MaxBagsPerLayout)
+		{
+			if (!Bags)
+			{
+				Bags = &Pool->FreeBags.Add(Layout);
+			}
+
+			// Drop the values (and any object references) but keep the memory.
+			Layout->ClearScriptStruct(Bag.GetMutableValue().GetMemory());
+			Bags->Add(MoveTemp(Bag));
+
+			++Pool->NumPooled;
+			INC_DWORD_STAT(STAT_ScriptableContextBagPool_NumPooled);
+		}
+	}
+
+	Bag.Reset();
+}
+
+bool FScriptableContextBagPool::Pop(const UPropertyBag* Layout, FInstancedPropertyBag& OutBag)
+{
+	TArray<FInstancedPropertyBag>* Bags = FreeBags.Find(Layout);
+	if (!Bags || Bags->IsEmpty())
+	{
+		return false;
+	}
+
+	OutBag = Bags->Pop(EAllowShrinking::No);
+	if (Bags->IsEmpty())
+	{
+		// Empty lists don't keep the layout alive, don't keep a key that could be reused by another layout either.
+		FreeBags.Remove(Layout);
+	}
+
+	--NumPooled;
+	DEC_DWORD_STAT(STAT_ScriptableContextBagPool_NumPooled);
+	return true;
+}
+
+void FScriptableContextBagPool::Trim()
+{
+	if (FScriptableContextBagPool* Pool = Get())
+	{
+		DEC_DWORD_STAT_BY(STAT_ScriptableContextBagPool_NumPooled, Pool->NumPooled);
+		Pool->FreeBags.Empty();
+		Pool->NumPooled = 0;
+	}
+}
+
+int32 FScriptableContextBagPool::GetNumPooled()
+{
+	const FScriptableContextBagPool* Pool = Get();
+	return Pool ? Pool->NumPooled : 0;
+}
+
+void FScriptableContextBagPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	// Each pooled bag references its own layout.
+	for (TPair<const UPropertyBag*, TArray<FInstancedPropertyBag>>& Pair : FreeBags)
+	{
+		for (FInstancedPropertyBag& Bag : Pair.Value)
+		{
+			Collector.AddPropertyReferencesWithStructARO(FInstancedPropertyBag::StaticStruct(), &Bag);
+		}
+	}
+}
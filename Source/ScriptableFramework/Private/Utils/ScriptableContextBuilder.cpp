@@ -0,0 +1,63 @@
+// Copyright 2026 kirzo
+
+#include "Utils/ScriptableContextBuilder.h"
+
+void FScriptableContextBuilder::AddDesc(const FName& Name, EPropertyBagContainerType ContainerType, EPropertyBagPropertyType ValueType, const UObject* ValueTypeObject)
+{
+	FPropertyBagPropertyDesc Desc(Name, ContainerType, ValueType, ValueTypeObject);
+
+	// IDs derived from the name keep the layout signature stable, so identical schemas share one bag struct.
+	Desc.ID = FGuid::NewDeterministicGuid(Name.ToString());
+
+	if (FPropertyBagPropertyDesc* Existing = Descs.FindByPredicate([&Name](const FPropertyBagPropertyDesc& Other) { return Other.Name == Name; }))
+	{
+		*Existing = Desc;
+	}
+	else
+	{
+		Descs.Add(Desc);
+	}
+
+	CachedBagStruct.Reset();
+}
+
+const UPropertyBag* FScriptableContextBuilder::GetBagStruct() const
+{
+	if (!CachedBagStruct.IsValid())
+	{
+		CachedBagStruct = UPropertyBag::GetOrCreateFromDescs(Descs);
+	}
+
+	return CachedBagStruct.Get();
+}
+
+void FScriptableContextBuilder::Apply(FInstancedPropertyBag& Bag) const
+{
+	if (Descs.IsEmpty())
+	{
+		return;
+	}
+
+	if (Bag.GetNumPropertiesInBag() == 0)
+	{
+		Bag.InitializeFromBagStruct(GetBagStruct());
+	}
+	else
+	{
+		// Merge with the existing layout, still a single re-layout.
+		Bag.AddProperties(Descs);
+	}
+
+	// The properties exist now, so the setters write without touching the layout.
+	for (const TFunction<void(FInstancedPropertyBag&)>& Setter : ValueSetters)
+	{
+		Setter(Bag);
+	}
+}
+
+FInstancedPropertyBag FScriptableContextBuilder::Build() const
+{
+	FInstancedPropertyBag Bag;
+	Apply(Bag);
+	return Bag;
+}
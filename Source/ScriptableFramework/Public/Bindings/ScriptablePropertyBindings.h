@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "PropertyBindingPath.h"
+#include "ScriptableContextScope.h"
 #include "ScriptablePropertyBindings.generated.h"
 
 struct FPropertyBindingDataView;
+class UScriptableObject;
 
 /** Defines a single binding: Copy from SourcePath -> TargetPath */
 USTRUCT()
@@ -24,6 +26,56 @@ struct SCRIPTABLEFRAMEWORK_API FScriptablePropertyBinding
 	FGuid SourceID;
 };
 
+/** Immutable binding list shared between a template object and its runtime copies. */
+struct FScriptableSharedBindings : public TSharedFromThis<FScriptableSharedBindings, ESPMode::ThreadSafe>
+{
+	TArray<FScriptablePropertyBinding> Bindings;
+};
+
+/**
+ * While in scope, objects duplicated on this thread reference their template's bindings
+ * instead of deep-copying them. Only use it for runtime copies that are never edited, usually through
+ * UScriptableObject::DuplicateForRuntime.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableSharedBindingsScope
+{
+	FScriptableSharedBindingsScope();
+	~FScriptableSharedBindingsScope();
+
+	static bool IsActive();
+};
+
+/**
+ * Lookups done once per registration for a binding list: the Context layer each Context binding reads from,
+ * and the leaf properties of bindings between two plain properties (no array index, no struct indirection).
+ * Rebuilt when the list, the target layout or the Context chain changes, or when a scope of the chain no longer has
+ * the layer layouts it had (checked per scope, so swapping views back and forth between the same types keeps the cache).
+ */
+struct FScriptableBindingCache
+{
+	struct FEntry
+	{
+		FScriptableContextLayerRef Source;
+		const FProperty* SourceProperty = nullptr;
+		const FProperty* TargetProperty = nullptr;
+	};
+
+	TArray<FEntry> Entries;
+	const FScriptablePropertyBinding* Bindings = nullptr;
+	const UStruct* TargetLayout = nullptr;
+	const FScriptableContextScope* Context = nullptr;
+	TArray<FScriptableContextScopeLayout> ContextLayouts;
+
+	void Reset()
+	{
+		Entries.Reset();
+		Bindings = nullptr;
+		TargetLayout = nullptr;
+		Context = nullptr;
+		ContextLayouts.Reset();
+	}
+};
+
 /** Container for all property bindings of an object. */
 USTRUCT()
 struct SCRIPTABLEFRAMEWORK_API FScriptablePropertyBindings
@@ -39,6 +91,9 @@ public:
 	void HandleArrayElementRemoved(const FName& ArrayName, int32 IndexRemoved);
 	void HandleArrayClear(const FName& ArrayName);
 
+	/** Rebases bindings targeting PropertyName (and its children) under NewParentName, for members moved into a struct. */
+	void HandlePropertyMoved(const FName& PropertyName, const FName& NewParentName);
+
 	/**
 	 * Retrieves the source path bound to the specified target path, if any.
 	 * @param TargetPath The path of the target property to find the binding for.
@@ -51,10 +106,56 @@ public:
 	 * Resolves all bindings and copies values to the TargetObject.
 	 * Handles both Context bindings and Task-to-Task bindings.
 	 */
-	void ResolveBindings(class UScriptableObject* TargetObject);
+	void ResolveBindings(class UScriptableObject* TargetObject, FScriptableBindingCache* Cache = nullptr);
+
+	/**
+	 * Resolves the given bindings into an arbitrary target view.
+	 * Context bindings read from the InContext scope chain, sibling bindings are looked up in InBindingMap.
+	 * With a Cache, the Context lookups are done once and reused by later calls.
+	 */
+	static void ResolveBindings(TConstArrayView<FScriptablePropertyBinding> InBindings, const FPropertyBindingDataView& TargetView, const FScriptableContextScope* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, FScriptableBindingCache* Cache = nullptr);
+
+	/** Changes whenever the list returned by GetBindings changes (edits, loads, undo/redo), for caches built from it. */
+	uint32 GetRevision() const { return Revision; }
+
+	/** Returns the bindings to resolve, either the shared template list or the local one. */
+	TConstArrayView<FScriptablePropertyBinding> GetBindings() const
+	{
+		return SharedBindings.IsValid() ? TConstArrayView<FScriptablePropertyBinding>(SharedBindings->Bindings) : TConstArrayView<FScriptablePropertyBinding>(Bindings);
+	}
+
+	/** Shares the binding list with runtime duplicates (see FScriptableSharedBindingsScope), tagged serialization otherwise. */
+	bool Serialize(FArchive& Ar);
+	void PostSerialize(const FArchive& Ar);
 
 	UPROPERTY()
 	TArray<FScriptablePropertyBinding> Bindings;
 
-	void CopySingleBinding(const FScriptablePropertyBinding& Binding, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView);
+	static void CopySingleBinding(const FScriptablePropertyBinding& Binding, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView);
+
+private:
+	/** Copies a leaf value, converting between compatible types (numbers, bools, object pointers). */
+	static void CopyValue(const FProperty* SourceProp, const void* SourceAddr, const FProperty* TargetProp, void* TargetAddr);
+
+	/** Fills Cache for InBindings (see FScriptableBindingCache). */
+	static void BuildCache(FScriptableBindingCache& Cache, TConstArrayView<FScriptablePropertyBinding> InBindings, const UStruct* TargetLayout, const FScriptableContextScope* InContext);
+
+	/** Drops the list handed to duplicates and bumps the revision. */
+	void OnBindingsChanged();
+
+	/** Template: lazily built copy handed to runtime duplicates. Runtime duplicate: the template's list, Bindings is empty. */
+	TSharedPtr<const FScriptableSharedBindings, ESPMode::ThreadSafe> SharedBindings;
+
+	/** See GetRevision. */
+	uint32 Revision = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptablePropertyBindings> : public TStructOpsTypeTraitsBase2<FScriptablePropertyBindings>
+{
+	enum
+	{
+		WithSerializer = true,
+		WithPostSerialize = true,
+	};
 };
\ No newline at end of file
@@ -4,8 +4,56 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableObject.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
 #include "ScriptableCondition.generated.h"
 
+/**
+ * Per-evaluation state handed to a condition running as a shared template.
+ * Filled by FScriptableRequirement for the duration of a single CheckCondition call.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableConditionInstance
+{
+	/** The object evaluating the requirement. */
+	UObject* Owner = nullptr;
+
+	/** Context of the requirement. */
+	const FScriptableContextScope* Context = nullptr;
+
+	/** Binding sources of the requirement. */
+	const TMap<FGuid, TObjectPtr<UScriptableObject>>* BindingMap = nullptr;
+
+	/** Mutable state of this instance, of the type returned by GetInstanceDataType(). */
+	FStructView InstanceData;
+
+	/** Context lookups of the instance data bindings, kept by the requirement across evaluations. */
+	FScriptableBindingCache* BindingCache = nullptr;
+
+	/** Typed access to the instance data. */
+	template<typename T>
+	T& GetInstanceData() const
+	{
+		return InstanceData.Get<T>();
+	}
+
+	/** Reads a value from the Context, or returns a default value if it is missing. */
+	template<typename T>
+	T GetContextValue(const FName& Name) const
+	{
+		return Context ? Context->GetValue<T>(Name) : T();
+	}
+};
+
+/**
+ * Base class for conditions.
+ *
+ * Conditions can opt into running as shared, read-only templates by returning a USTRUCT from GetInstanceDataType()
+ * and holding a UPROPERTY of that type with the authored defaults. Bindable and mutable values go in that struct.
+ * Each requirement then keeps a copy of the struct per instance instead of duplicating or registering the condition,
+ * and Evaluate reads it through GetInstanceData<T>().
+ * When moving existing members into the struct, keep the old ones as editor-only Name_DEPRECATED properties:
+ * PostLoad copies them over and rebases their bindings.
+ */
 UCLASS(Abstract, DefaultToInstanced, EditInlineNew, Blueprintable, BlueprintType, HideCategories = (Hidden, Tick), CollapseCategories)
 class SCRIPTABLEFRAMEWORK_API UScriptableCondition : public UScriptableObject
 {
@@ -16,6 +64,8 @@ protected:
 	uint8 bNegate : 1 = 0;
 
 public:
+	virtual void PostLoad() override;
+
 	FORCEINLINE bool IsNegated() const { return bNegate; }
 
 	/** Conditions should typically be instant checks, not ticking objects. */
@@ -27,6 +77,44 @@ public:
 	 */
 	bool CheckCondition();
 
+	/** Evaluates this condition as a shared template against the given instance. Handles Bindings and Negation. */
+	bool CheckCondition(const FScriptableConditionInstance& Instance) const;
+
+	/** Returns the per-instance state struct declared by this class, or nullptr if the condition keeps its state on itself. */
+	virtual const UScriptStruct* GetInstanceDataType() const { return nullptr; }
+
+	/** True if this condition is evaluated as a shared template with per-instance data. */
+	bool IsSharedTemplate() const { return GetInstanceDataType() != nullptr; }
+
+	/** Initializes per-instance data from the authored defaults. */
+	void InitInstanceData(FInstancedStruct& OutInstanceData) const;
+
+protected:
+	/**
+	 * Returns the instance data of the current shared evaluation,
+	 * or the authored defaults when evaluated as a regular (non-shared) condition.
+	 */
+	template<typename T>
+	const T& GetInstanceData() const
+	{
+		if (ActiveInstance && ActiveInstance->InstanceData.IsValid())
+		{
+			return ActiveInstance->InstanceData.Get<T>();
+		}
+
+		const FStructProperty* InstanceDataProperty = FindInstanceDataProperty();
+		check(InstanceDataProperty && InstanceDataProperty->Struct == T::StaticStruct());
+		return *InstanceDataProperty->ContainerPtrToValuePtr<T>(this);
+	}
+
+#if WITH_EDITOR
+	/** GetBindingDisplayText for a member of the instance data struct. */
+	bool GetInstanceDataBindingDisplayText(FName MemberName, FString& OutText) const;
+#endif
+
+	/** Returns the owner of the current evaluation, valid for both shared and regular conditions. */
+	UObject* GetEvaluationOwner() const { return ActiveInstance ? ActiveInstance->Owner : GetOwner(); }
+
 protected:
 	/**
 	 * Implementation of the specific condition check.
@@ -36,5 +124,39 @@ protected:
 	bool Evaluate() const;
 
 private:
+	friend class FScriptableConditionTemplateCache;
+
 	virtual bool Evaluate_Implementation() const { return false; }
+
+	/** Hash of a shared template's class, authored values and binding sources (see FScriptableConditionTemplateCache). */
+	uint32 GetTemplateHash() const;
+
+	/** True if Other has the same class, authored values and bindings, so either can be evaluated in place of the other. */
+	bool IsEquivalentTemplate(const UScriptableCondition& Other) const;
+
+	/** Finds the UPROPERTY holding the authored instance data defaults. */
+	const FStructProperty* FindInstanceDataProperty() const;
+
+#if WITH_EDITOR
+	/** Moves the values and bindings of Name_DEPRECATED properties into the instance data member of the same name. */
+	void MigrateDeprecatedToInstanceData();
+#endif
+
+	/** Copies bound values into the instance data of the current shared evaluation. */
+	void ResolveInstanceDataBindings(const FScriptableConditionInstance& Instance) const;
+
+	/** Cached result of FindInstanceDataProperty. */
+	mutable const FStructProperty* CachedInstanceDataProperty = nullptr;
+	mutable bool bInstanceDataPropertyCached = false;
+
+	/** Instance being evaluated while running as a shared template. */
+	mutable const FScriptableConditionInstance* ActiveInstance = nullptr;
+
+	/** Bindings rebased onto the instance data struct. Built once and shared by every instance. */
+	mutable TArray<FScriptablePropertyBinding> InstanceDataBindings;
+	mutable bool bInstanceDataBindingsBuilt = false;
+	mutable uint32 InstanceDataBindingsRevision = 0;
+
+	/** True for the single instance that equivalent shared templates are replaced with when loaded. */
+	bool bCanonicalTemplate = false;
 };
\ No newline at end of file
@@ -0,0 +1,56 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptableConditions/ScriptableCondition.h"
+#include "ScriptableConditionNode.generated.h"
+
+/**
+ * Base struct for lightweight, struct-based conditions.
+ * Stored as FInstancedStruct in FScriptableRequirement::ConditionNodes: no UObject, no GC tracking and no tick function.
+ * Nodes are shared and read-only at runtime; mutable state goes into the struct returned by GetInstanceDataType().
+ * Inputs are read from the Context through FScriptableConditionInstance::GetContextValue.
+ */
+USTRUCT(meta = (Hidden))
+struct SCRIPTABLEFRAMEWORK_API FScriptableConditionNode
+{
+	GENERATED_BODY()
+
+	virtual ~FScriptableConditionNode() = default;
+
+	/** If true, the result of the evaluation is inverted. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	uint8 bNegate : 1 = false;
+
+	/** Returns the per-instance state struct of this node, or nullptr if it is stateless. */
+	virtual const UScriptStruct* GetInstanceDataType() const { return nullptr; }
+
+	/** Main entry point for evaluation. Handles Negation. */
+	bool CheckCondition(const FScriptableConditionInstance& Instance) const
+	{
+		const bool bResult = Evaluate(Instance);
+		return bNegate ? !bResult : bResult;
+	}
+
+protected:
+	/** Implementation of the specific condition check. Do NOT handle Negation here. */
+	virtual bool Evaluate(const FScriptableConditionInstance& Instance) const { return false; }
+};
+
+/** Returns the value of a boolean Context variable. */
+USTRUCT(DisplayName = "Context Bool", meta = (ConditionCategory = "System|Logic"))
+struct SCRIPTABLEFRAMEWORK_API FScriptableConditionNode_ContextBool : public FScriptableConditionNode
+{
+	GENERATED_BODY()
+
+	/** Name of the Context variable to read. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	FName ContextName;
+
+protected:
+	virtual bool Evaluate(const FScriptableConditionInstance& Instance) const override
+	{
+		return Instance.GetContextValue<bool>(ContextName);
+	}
+};
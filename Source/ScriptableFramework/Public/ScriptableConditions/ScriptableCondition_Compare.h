@@ -17,13 +17,12 @@ enum class EScriptableComparisonOp : uint8
 	GreaterOrEqual  UMETA(DisplayName = ">=")
 };
 
-/** System condition to compare two numbers (Floats, Ints, Doubles). */
-UCLASS(DisplayName = "Compare Numbers", meta = (ConditionCategory = "System|Math"))
-class SCRIPTABLEFRAMEWORK_API UScriptableCondition_CompareNumbers : public UScriptableCondition
+/** Instance data of UScriptableCondition_CompareNumbers. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_CompareNumbersInstanceData
 {
 	GENERATED_BODY()
 
-public:
 	/** The first value to compare */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	double A = 0.0;
@@ -39,6 +38,19 @@ public:
 	/** Error tolerance for float equality checks. Only used for == and != */
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "Operation == EScriptableComparisonOp::Equal || Operation == EScriptableComparisonOp::NotEqual", EditConditionHides))
 	double ErrorTolerance = 1.e-4;
+};
+
+/** System condition to compare two numbers (Floats, Ints, Doubles). */
+UCLASS(DisplayName = "Compare Numbers", meta = (ConditionCategory = "System|Math"))
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_CompareNumbers : public UScriptableCondition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_CompareNumbersInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_CompareNumbersInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -46,15 +58,29 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	double A_DEPRECATED = 0.0;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	double B_DEPRECATED = 0.0;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	EScriptableComparisonOp Operation_DEPRECATED = EScriptableComparisonOp::Equal;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	double ErrorTolerance_DEPRECATED = 1.e-4;
+#endif
 };
 
-/** Checks the distance between two Actors. */
-UCLASS(DisplayName = "Distance Check", meta = (ConditionCategory = "System|Spatial"))
-class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Distance : public UScriptableCondition
+/** Instance data of UScriptableCondition_Distance. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_DistanceInstanceData
 {
 	GENERATED_BODY()
 
-public:
 	/** The origin actor. */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	TObjectPtr<AActor> Origin = nullptr;
@@ -70,6 +96,19 @@ public:
 	/** The distance threshold to compare against. */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	float Distance = 500.0f;
+};
+
+/** Checks the distance between two Actors. */
+UCLASS(DisplayName = "Distance Check", meta = (ConditionCategory = "System|Spatial"))
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Distance : public UScriptableCondition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_DistanceInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_DistanceInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -77,4 +116,19 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	TObjectPtr<AActor> Origin_DEPRECATED = nullptr;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	TObjectPtr<AActor> Target_DEPRECATED = nullptr;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	EScriptableComparisonOp Operation_DEPRECATED = EScriptableComparisonOp::Less;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	float Distance_DEPRECATED = 500.0f;
+#endif
 };
\ No newline at end of file
@@ -28,6 +28,7 @@ public:
 	// Lifecycle Forwarding
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
+	virtual void InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap) override;
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
@@ -17,6 +17,17 @@ enum class EScriptableBoolOp : uint8
 	NotEqual        UMETA(DisplayName = "!=")
 };
 
+/** Instance data of UScriptableCondition_Bool. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_BoolInstanceData
+{
+	GENERATED_BODY()
+
+	/** The boolean value to check. Bind this to a Context variable. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	bool bValue = true;
+};
+
 /** Basic condition that returns the value of a boolean property (from context or static). */
 UCLASS(DisplayName = "Bool Check", meta = (ConditionCategory = "System|Logic"))
 class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Bool : public UScriptableCondition
@@ -24,9 +35,10 @@ class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Bool : public UScriptableCond
 	GENERATED_BODY()
 
 public:
-	/** The boolean value to check. Bind this to a Context variable. */
-	UPROPERTY(EditAnywhere, Category = "Config")
-	bool bValue = true;
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_BoolInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_BoolInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -34,15 +46,20 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	bool bValue_DEPRECATED = true;
+#endif
 };
 
-/** System condition to compare two boolean values with logical operators. */
-UCLASS(DisplayName = "Compare Booleans", meta = (ConditionCategory = "System|Logic"))
-class SCRIPTABLEFRAMEWORK_API UScriptableCondition_CompareBooleans : public UScriptableCondition
+/** Instance data of UScriptableCondition_CompareBooleans. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_CompareBooleansInstanceData
 {
 	GENERATED_BODY()
 
-public:
 	/** The first boolean value */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	bool bA = false;
@@ -54,6 +71,19 @@ public:
 	/** The logical operator to apply */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	EScriptableBoolOp Operation = EScriptableBoolOp::And;
+};
+
+/** System condition to compare two boolean values with logical operators. */
+UCLASS(DisplayName = "Compare Booleans", meta = (ConditionCategory = "System|Logic"))
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_CompareBooleans : public UScriptableCondition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_CompareBooleansInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_CompareBooleansInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -61,6 +91,29 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	bool bA_DEPRECATED = false;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	bool bB_DEPRECATED = false;
+
+	UPROPERTY(meta = (DeprecatedProperty))
+	EScriptableBoolOp Operation_DEPRECATED = EScriptableBoolOp::And;
+#endif
+};
+
+/** Instance data of UScriptableCondition_Probability. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_ProbabilityInstanceData
+{
+	GENERATED_BODY()
+
+	/** The probability to return true (0 to 1) */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0, ClampMax = 1, UIMin = 0, UIMax = 1))
+	float Chance = 0.5f;
 };
 
 /**
@@ -73,9 +126,10 @@ class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Probability : public UScripta
 	GENERATED_BODY()
 
 public:
-	/** The probability to return true (0 to 1) */
-	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0, ClampMax = 1, UIMin = 0, UIMax = 1))
-	float Chance = 0.5f;
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_ProbabilityInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_ProbabilityInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -83,6 +137,23 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	float Chance_DEPRECATED = 0.5f;
+#endif
+};
+
+/** Instance data of UScriptableCondition_IsValid. */
+USTRUCT()
+struct SCRIPTABLEFRAMEWORK_API FScriptableCondition_IsValidInstanceData
+{
+	GENERATED_BODY()
+
+	/** The object to validate. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	TObjectPtr<UObject> TargetObject = nullptr;
 };
 
 /** Checks if a UObject is valid (not null and not pending kill). */
@@ -92,9 +163,10 @@ class SCRIPTABLEFRAMEWORK_API UScriptableCondition_IsValid : public UScriptableC
 	GENERATED_BODY()
 
 public:
-	/** The object to validate. */
-	UPROPERTY(EditAnywhere, Category = "Config")
-	TObjectPtr<UObject> TargetObject = nullptr;
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ShowOnlyInnerProperties))
+	FScriptableCondition_IsValidInstanceData InstanceData;
+
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableCondition_IsValidInstanceData::StaticStruct(); }
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
@@ -102,4 +174,10 @@ public:
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	UPROPERTY(meta = (DeprecatedProperty))
+	TObjectPtr<UObject> TargetObject_DEPRECATED = nullptr;
+#endif
 };
\ No newline at end of file
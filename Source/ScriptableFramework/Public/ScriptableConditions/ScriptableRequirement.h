@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableContainer.h"
+#include "Bindings/ScriptablePropertyBindings.h"
+#include "StructUtils/InstancedStruct.h"
+#include "ScriptableConditions/ScriptableConditionNode.h"
 #include "ScriptableRequirement.generated.h"
 
 class UScriptableCondition;
@@ -34,10 +37,28 @@ public:
 	UPROPERTY(EditAnywhere, Instanced, Category = "Conditions")
 	TArray<TObjectPtr<UScriptableCondition>> Conditions;
 
+	/**
+	 * Lightweight struct-based conditions (see FScriptableConditionNode).
+	 * Evaluated before the object conditions, so cheap checks can short-circuit the group.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Conditions", meta = (BaseStruct = "/Script/ScriptableFramework.ScriptableConditionNode", ExcludeBaseStruct))
+	TArray<FInstancedStruct> ConditionNodes;
+
 private:
 	UPROPERTY(Transient)
 	uint8 bIsRegistered : 1 = false;
 
+	/** Per-instance data of conditions evaluated as shared templates. Indexed like Conditions. */
+	UPROPERTY(Transient)
+	TArray<FInstancedStruct> ConditionInstanceData;
+
+	/** Binding lookups of the conditions evaluated as shared templates. Indexed like Conditions. */
+	mutable TArray<FScriptableBindingCache> ConditionBindingCaches;
+
+	/** Per-instance data of the struct conditions. Indexed like ConditionNodes. */
+	UPROPERTY(Transient)
+	TArray<FInstancedStruct> ConditionNodeInstanceData;
+
 	// -------------------------------------------------------------------
 	// API
 	// -------------------------------------------------------------------
@@ -47,11 +68,22 @@ public:
 
 	void Unregister();
 
+	/**
+	 * Evaluates the group, stopping at the first result that decides it (a failure for AND, a success for OR).
+	 * ConditionNodes are always evaluated before Conditions, each list in authored order.
+	 */
 	bool Evaluate() const;
 
-	bool IsEmpty() const { return Conditions.IsEmpty(); }
+	/**
+	 * Evaluates with host-owned structs as additional Context, read in place (see SetExternalContext).
+	 * The views only apply to this call, nothing is copied or allocated.
+	 */
+	bool Evaluate(TConstArrayView<FConstStructView> ContextSources) const;
+
+	bool IsEmpty() const { return Conditions.IsEmpty() && ConditionNodes.IsEmpty(); }
 
 public:
 	/** Static entry point to evaluate a requirement. */
 	static bool EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement);
+	static bool EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement, TConstArrayView<FConstStructView> ContextSources);
 };
\ No newline at end of file
@@ -36,23 +36,42 @@ class SCRIPTABLEFRAMEWORK_API UScriptableCondition_Asset final : public UScripta
 	GENERATED_BODY()
 
 public:
-	/** The asset containing the Requirement definition to evaluate. */
+	/** The asset containing the Requirement definition to evaluate. Cleared in cooked data once the requirement is inlined. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Config")
 	TObjectPtr<UScriptableRequirementAsset> Asset;
 
 	// --- Lifecycle ---
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
+	virtual void InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap) override;
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
+	virtual void InlineReferencedAssets(TArray<const UObject*>& AssetStack) override;
 #endif
 
 protected:
 	virtual bool Evaluate_Implementation() const override;
 
 private:
+	/** Builds a transient group holding a runtime copy of the asset's requirement, outered to this condition. */
+	class UScriptableCondition_Group* CreateGroupFromAsset();
+
 	/** The actual instance created from the asset template. */
 	UPROPERTY(Transient)
-	TObjectPtr<UScriptableCondition> Condition;
+	TObjectPtr<class UScriptableCondition_Group> Condition;
+
+	/**
+	 * Cooked copy of the asset's requirement, with its conditions owned by this condition (see InlineReferencedAssets).
+	 * When present it is registered and evaluated in place, instead of building a transient group on every registration.
+	 */
+	UPROPERTY()
+	FScriptableRequirement InlinedRequirement;
+
+	/** The asset's Context as it was cooked, restored into InlinedRequirement on unregistration. */
+	UPROPERTY()
+	FInstancedPropertyBag InlinedContextDefaults;
+
+	UPROPERTY()
+	uint8 bHasInlinedRequirement : 1 = false;
 };
\ No newline at end of file
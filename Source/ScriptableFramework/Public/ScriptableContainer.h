@@ -4,7 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "StructUtils/PropertyBag.h"
+#include "StructUtils/InstancedStruct.h"
 #include "Utils/PropertyBagHelpers.h"
+#include "Utils/ScriptableContextKey.h"
+#include "ScriptableContextScope.h"
 #include "ScriptableContainer.generated.h"
 
 class UScriptableObject;
@@ -20,6 +23,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config")
 	FInstancedPropertyBag Context;
 
+	/**
+	 * Optional fixed-layout Context, for hosts that know the signature at compile time (e.g. FMyAbilityContext).
+	 * Read in place by bindings like the bag, and filled with a plain struct assignment (see SetContextStruct).
+	 * Searched before Context when both declare the same name.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	FInstancedStruct ContextStruct;
+
 protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UObject> Owner = nullptr;
@@ -29,8 +40,29 @@ private:
 	UPROPERTY(Transient)
 	TMap<FGuid, TObjectPtr<UScriptableObject>> BindingSourceMap;
 
+	/** This container's layer of the context chain: the local Context on top of the owner's scope. */
+	FScriptableContextScope LocalScope;
+
+	/** Views set with SetExternalContext, referenced by LocalScope. */
+	TArray<FConstStructView> ExternalContext;
+
+	/** Parent scope to use instead of the owner's, see SetParentScope. */
+	const FScriptableContextScope* ParentScopeOverride = nullptr;
+
+	/** True once children were given LocalScope, they keep it until Unregister. */
+	mutable bool bLocalScopeHandedOut = false;
+
 public:
-	bool HasContext() const { return Context.IsValid(); }
+	FScriptableContainer() = default;
+
+	/**
+	 * Copies the authored Context only. The runtime state (owner, binding sources, scope) points into the source container,
+	 * so a copy (e.g. an asset's action copied into a runner) starts unregistered.
+	 */
+	FScriptableContainer(const FScriptableContainer& Other);
+	FScriptableContainer& operator=(const FScriptableContainer& Other);
+
+	bool HasContext() const { return Context.IsValid() || ContextStruct.IsValid(); }
 
 	FInstancedPropertyBag& GetContext() { return Context; }
 	const FInstancedPropertyBag& GetContext() const { return Context; }
@@ -49,12 +81,14 @@ public:
 	void AddContextProperty(const FName& Name)
 	{
 		ScriptablePropertyBag::Add<T>(Context, Name);
+		RefreshChildScopes();
 	}
 
 	template <typename T>
 	void SetContextProperty(const FName& Name, const T& Value)
 	{
 		ScriptablePropertyBag::Set(Context, Name, Value);
+		RefreshChildScopes();
 	}
 
 	template <typename T>
@@ -64,6 +98,57 @@ public:
 		return Result.HasValue() ? Result.GetValue() : T();
 	}
 
+	/** Writes through a pre-resolved key, see TScriptableContextKey. */
+	template <typename T>
+	void SetContextProperty(const TScriptableContextKey<T>& Key, const T& Value)
+	{
+		Key.Set(Context, Value);
+	}
+
+	/** Reads through a pre-resolved key, see TScriptableContextKey. */
+	template <typename T>
+	T GetContextProperty(const TScriptableContextKey<T>& Key) const
+	{
+		return Key.Get(Context);
+	}
+
+	/** Returns the struct Context as T, or nullptr if it holds another type. */
+	template <typename T>
+	T* GetContextStruct()
+	{
+		return ContextStruct.GetMutablePtr<T>();
+	}
+
+	template <typename T>
+	const T* GetContextStruct() const
+	{
+		return ContextStruct.GetPtr<T>();
+	}
+
+	/** Assigns the struct Context, (re)initializing it as T if it holds another type. */
+	template <typename T>
+	void SetContextStruct(const T& Value)
+	{
+		if (T* Existing = ContextStruct.GetMutablePtr<T>())
+		{
+			*Existing = Value;
+		}
+		else
+		{
+			ContextStruct.InitializeAs<T>(Value);
+			OnContextStructChanged();
+		}
+	}
+
+	/**
+	 * Exposes host-owned structs as Context, read in place by bindings instead of being copied into the bag.
+	 * Their members are looked up by name before the container's own Context. Replaces the previous views.
+	 * The memory is not copied: the views must stay valid until cleared. Cleared on Unregister.
+	 */
+	void SetExternalContext(TConstArrayView<FConstStructView> Views);
+
+	void ClearExternalContext() { SetExternalContext({}); }
+
 	/** Finds a registered object by its persistent ID (used by Property Bindings). */
 	UScriptableObject* FindBindingSource(const FGuid& InID) const;
 
@@ -71,7 +156,49 @@ protected:
 	/** Populates the map and initializes the child with this context. */
 	void AddBindingSource(UScriptableObject* InSource);
 
+	/**
+	 * Returns the Context scope passed down to children: this container's layer if it declares anything
+	 * (struct, bag properties or external views), otherwise the enclosing scope so lookups skip an empty layer.
+	 */
+	const FScriptableContextScope* GetEffectiveContext() const;
+
+	/** Re-points registered children at our layer once it starts declaring something (they were given the enclosing scope). */
+	void RefreshChildScopes() const;
+
+	/** Keeps the local scope pointing at the struct Context after it was reallocated. */
+	void OnContextStructChanged();
+
+	/** Temporarily replaces the external views of a registered container, without copying them. */
+	struct FExternalContextGuard
+	{
+		FExternalContextGuard(const FScriptableContainer& Container, TConstArrayView<FConstStructView> Views);
+		~FExternalContextGuard();
+
+	private:
+		FScriptableContextScope& Scope;
+		TConstArrayView<FConstStructView> PreviousViews;
+	};
+
+
+	const TMap<FGuid, TObjectPtr<UScriptableObject>>& GetBindingSourceMap() const { return BindingSourceMap; }
+
 public:
+	/**
+	 * Sets the enclosing scope used by the next Register, for containers whose owner isn't their logical parent
+	 * (e.g. the runtime action of a Run Asset task). Cleared on Unregister.
+	 */
+	void SetParentScope(const FScriptableContextScope* InParentScope) { ParentScopeOverride = InParentScope; }
+
+	/** Re-chains a registered container (and its children) to a new enclosing scope, when its owner was re-pointed. */
+	void UpdateParentScope(const FScriptableContextScope* InParentScope);
+
+	/**
+	 * Overwrites the local Context values with same-named, same-typed values from the enclosing scopes.
+	 * Used by asset wrappers: the asset declares its parameters (with defaults) and the caller supplies them,
+	 * without copying the caller's whole bag.
+	 */
+	void PullContextFromParent();
+
 	/** Initializes the container. */
 	void Register(UObject* InOwner);
 
@@ -0,0 +1,247 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/PropertyBag.h"
+#include "StructUtils/StructView.h"
+#include "PropertyBindingDataView.h"
+#include "Utils/PropertyBagHelpers.h"
+
+struct FScriptableContextScope;
+
+/** Part of a scope holding a Context variable. */
+enum class EScriptableContextLayer : uint8
+{
+	External,
+	Struct,
+	Bag,
+};
+
+/**
+ * Where a Context variable was found, so later reads can skip the name lookup.
+ * Goes stale when the layer changes layout (checked by FScriptableContextScope::GetLayerView).
+ */
+struct FScriptableContextLayerRef
+{
+	const FScriptableContextScope* Scope = nullptr;
+	EScriptableContextLayer Layer = EScriptableContextLayer::Bag;
+	int32 ExternalIndex = INDEX_NONE;
+
+	/** Layout of the layer when the variable was found. */
+	const UScriptStruct* Layout = nullptr;
+
+	FScriptableContextLayerRef() = default;
+	FScriptableContextLayerRef(const FScriptableContextScope* InScope, EScriptableContextLayer InLayer, const UScriptStruct* InLayout, int32 InExternalIndex = INDEX_NONE)
+		: Scope(InScope), Layer(InLayer), ExternalIndex(InExternalIndex), Layout(InLayout)
+	{
+	}
+
+	bool IsSet() const { return Scope != nullptr; }
+};
+
+/** Layouts of the layers of one scope, to tell whether lookups made in a chain still find the same layers. */
+struct FScriptableContextScopeLayout
+{
+	const FScriptableContextScope* Scope = nullptr;
+	const UScriptStruct* Struct = nullptr;
+	const UScriptStruct* Bag = nullptr;
+	TArray<const UScriptStruct*, TInlineAllocator<2>> ExternalStructs;
+};
+
+/**
+ * One layer of a context chain.
+ * A scope only references its own bag and its parent scope, nothing is copied.
+ * Name lookups walk from the innermost scope outwards, so inner declarations shadow outer ones.
+ * Within a scope, external views are searched first, then the fixed-layout Struct, then the Bag.
+ */
+struct FScriptableContextScope
+{
+	/** The bag declared by this scope. */
+	const FInstancedPropertyBag* Bag = nullptr;
+
+	/** Fixed-layout data declared by this scope (a USTRUCT context), read in place. */
+	FConstStructView Struct;
+
+	/** Host-owned structs read in place (e.g. component state, Mass fragments), see FScriptableContainer::SetExternalContext. */
+	TConstArrayView<FConstStructView> ExternalStructs;
+
+	/** The enclosing scope, or nullptr for the root. */
+	const FScriptableContextScope* Parent = nullptr;
+
+	/** Finds the innermost layer (external view, struct or bag) of the chain declaring the property. */
+	FScriptableContextLayerRef FindLayerWithProperty(const FName& Name, const FProperty** OutProperty = nullptr) const
+	{
+		for (const FScriptableContextScope* Scope = this; Scope; Scope = Scope->Parent)
+		{
+			for (int32 Index = 0; Index < Scope->ExternalStructs.Num(); ++Index)
+			{
+				const UScriptStruct* ExternalStruct = Scope->ExternalStructs[Index].GetScriptStruct();
+				if (FindInStruct(ExternalStruct, Name, OutProperty))
+				{
+					return FScriptableContextLayerRef(Scope, EScriptableContextLayer::External, ExternalStruct, Index);
+				}
+			}
+
+			if (FindInStruct(Scope->Struct.GetScriptStruct(), Name, OutProperty))
+			{
+				return FScriptableContextLayerRef(Scope, EScriptableContextLayer::Struct, Scope->Struct.GetScriptStruct());
+			}
+
+			if (Scope->Bag)
+			{
+				if (const FPropertyBagPropertyDesc* Desc = Scope->Bag->FindPropertyDescByName(Name))
+				{
+					if (OutProperty)
+					{
+						*OutProperty = Desc->CachedProperty;
+					}
+					return FScriptableContextLayerRef(Scope, EScriptableContextLayer::Bag, Scope->Bag->GetPropertyBagStruct());
+				}
+			}
+		}
+
+		return FScriptableContextLayerRef();
+	}
+
+	/** Returns a view of the referenced layer, or an invalid view if it no longer has the layout the variable was found in. */
+	static FPropertyBindingDataView GetLayerView(const FScriptableContextLayerRef& Ref)
+	{
+		if (!Ref.Scope)
+		{
+			return FPropertyBindingDataView();
+		}
+
+		FConstStructView View;
+		switch (Ref.Layer)
+		{
+			case EScriptableContextLayer::External:
+			View = Ref.Scope->ExternalStructs.IsValidIndex(Ref.ExternalIndex) ? Ref.Scope->ExternalStructs[Ref.ExternalIndex] : FConstStructView();
+			break;
+
+			case EScriptableContextLayer::Struct:
+			View = Ref.Scope->Struct;
+			break;
+
+			case EScriptableContextLayer::Bag:
+			View = Ref.Scope->Bag ? Ref.Scope->Bag->GetValue() : FConstStructView();
+			break;
+		}
+
+		if (!View.GetScriptStruct() || View.GetScriptStruct() != Ref.Layout)
+		{
+			return FPropertyBindingDataView();
+		}
+
+		return FPropertyBindingDataView(Ref.Layout, const_cast<uint8*>(View.GetMemory()));
+	}
+
+	/**
+	 * Returns a view of the innermost layer (struct or bag) declaring the property, or an invalid view.
+	 * This is what bindings read from, so both kinds of layer are resolved the same way.
+	 */
+	FPropertyBindingDataView FindViewWithProperty(const FName& Name, const FProperty** OutProperty = nullptr) const
+	{
+		return GetLayerView(FindLayerWithProperty(Name, OutProperty));
+	}
+
+	/** Captures the layer layouts of the chain, see HasChainLayouts. */
+	void GetChainLayouts(TArray<FScriptableContextScopeLayout>& OutLayouts) const
+	{
+		OutLayouts.Reset();
+		for (const FScriptableContextScope* Scope = this; Scope; Scope = Scope->Parent)
+		{
+			FScriptableContextScopeLayout& Layout = OutLayouts.AddDefaulted_GetRef();
+			Layout.Scope = Scope;
+			Layout.Struct = Scope->Struct.GetScriptStruct();
+			Layout.Bag = Scope->Bag ? Scope->Bag->GetPropertyBagStruct() : nullptr;
+			for (const FConstStructView& View : Scope->ExternalStructs)
+			{
+				Layout.ExternalStructs.Add(View.GetScriptStruct());
+			}
+		}
+	}
+
+	/**
+	 * True if every scope of the chain still has the layer layouts captured by GetChainLayouts,
+	 * so names are still found in the same layers (no inner layer started shadowing them).
+	 */
+	bool HasChainLayouts(TConstArrayView<FScriptableContextScopeLayout> Layouts) const
+	{
+		int32 Index = 0;
+		for (const FScriptableContextScope* Scope = this; Scope; Scope = Scope->Parent, ++Index)
+		{
+			if (!Layouts.IsValidIndex(Index))
+			{
+				return false;
+			}
+
+			const FScriptableContextScopeLayout& Layout = Layouts[Index];
+			if (Layout.Scope != Scope || Layout.Struct != Scope->Struct.GetScriptStruct()
+				|| Layout.Bag != (Scope->Bag ? Scope->Bag->GetPropertyBagStruct() : nullptr)
+				|| Layout.ExternalStructs.Num() != Scope->ExternalStructs.Num())
+			{
+				return false;
+			}
+
+			for (int32 ExternalIndex = 0; ExternalIndex < Layout.ExternalStructs.Num(); ++ExternalIndex)
+			{
+				if (Layout.ExternalStructs[ExternalIndex] != Scope->ExternalStructs[ExternalIndex].GetScriptStruct())
+				{
+					return false;
+				}
+			}
+		}
+
+		return Index == Layouts.Num();
+	}
+
+	/** Returns the innermost bag of the chain with at least one property, or nullptr. */
+	const FInstancedPropertyBag* FindFirstNonEmptyBag() const
+	{
+		for (const FScriptableContextScope* Scope = this; Scope; Scope = Scope->Parent)
+		{
+			if (Scope->Bag && Scope->Bag->GetNumPropertiesInBag() > 0)
+			{
+				return Scope->Bag;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool HasProperty(const FName& Name) const
+	{
+		return FindViewWithProperty(Name).IsValid();
+	}
+
+	/** Reads a value from the chain, or returns a default value if no scope declares it (or declares it with another type). */
+	template<typename T>
+	T GetValue(const FName& Name) const
+	{
+		const FProperty* Property = nullptr;
+		const FPropertyBindingDataView View = FindViewWithProperty(Name, &Property);
+
+		T Value = T();
+		if (View.IsValid() && Property)
+		{
+			ScriptablePropertyBag::Private::ReadPropertyValue<T>(Property, View.GetMemory(), Value);
+		}
+		return Value;
+	}
+
+private:
+	static bool FindInStruct(const UScriptStruct* ScriptStruct, const FName& Name, const FProperty** OutProperty)
+	{
+		if (const FProperty* Property = ScriptStruct ? ScriptStruct->FindPropertyByName(Name) : nullptr)
+		{
+			if (OutProperty)
+			{
+				*OutProperty = Property;
+			}
+			return true;
+		}
+
+		return false;
+	}
+};
\ No newline at end of file
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ScriptableFramework"), STATGROUP_ScriptableFramework, STATCAT_Advanced);
 
 class FScriptableFrameworkModule : public IModuleInterface
 {
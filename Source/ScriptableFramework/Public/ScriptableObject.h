@@ -6,10 +6,14 @@
 #include "UObject/NoExportTypes.h"
 #include "StructUtils/PropertyBag.h"
 #include "ScriptableObjectTypes.h"
+#include "ScriptableContextScope.h"
 #include "PropertyBindingPath.h"
 #include "Bindings/ScriptablePropertyBindings.h"
 #include "ScriptableObject.generated.h"
 
+class ITargetPlatform;
+class UScriptableObjectRegistry;
+
 SCRIPTABLEFRAMEWORK_API DECLARE_LOG_CATEGORY_EXTERN(LogScriptableObject, Log, All);
 
 /** Base class for all scriptable objects in the framework. */
@@ -19,16 +23,24 @@ class SCRIPTABLEFRAMEWORK_API UScriptableObject : public UObject
 	GENERATED_BODY()
 
 	friend class UScriptableCondition;
+	friend class UScriptableObjectRegistry;
 
 public:
 	UScriptableObject();
 
 	virtual void PostInitProperties() override;
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+	virtual bool NeedsLoadForServer() const override;
+	virtual bool NeedsLoadForClient() const override;
 	virtual UWorld* GetWorld() const override final { return (WorldPrivate ? WorldPrivate : GetWorld_Uncached()); }
 
 #if WITH_EDITOR
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
+	virtual bool NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const override;
+
+	/** When cooking, inlines the assets referenced by this object (see InlineReferencedAssets and Scriptable.Cook.InlineAssets). */
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 
 	/**
 	 * Returns a user-friendly title of this condition.
@@ -44,6 +56,19 @@ public:
 	 * @return True if the property is bound, false otherwise.
 	 */
 	bool GetBindingDisplayText(FName PropertyName, FString& OutText, bool bChopPrefix = true) const;
+
+	/** Same as above, for a nested property (TargetPath segments, the struct ID is filled in). */
+	bool GetBindingDisplayText(FPropertyBindingPath TargetPath, FString& OutText, bool bChopPrefix = true) const;
+
+	/**
+	 * Cook step for objects that reference other assets (Run Asset, Evaluate Asset), called from PreSave:
+	 * copies the asset's contents into this object so the runtime doesn't duplicate them on every run.
+	 * AssetStack holds the assets currently being inlined, to stop on recursive references.
+	 */
+	virtual void InlineReferencedAssets(TArray<const UObject*>& AssetStack) {}
+
+	/** Calls InlineReferencedAssets on Root and on every scriptable object it owns. */
+	static void InlineReferencedAssetsInHierarchy(UObject* Root, TArray<const UObject*>& AssetStack);
 #endif
 
 	// -------------------------------------------------------------------
@@ -65,6 +90,12 @@ public:
 	/** Returns true if the object is enabled. */
 	FORCEINLINE bool IsEnabled() const { return bEnabled; }
 
+	/**
+	 * Returns false if NetTarget or bDevelopmentOnly exclude this object from the running build.
+	 * Containers drop such objects on registration; cooks for the matching targets don't include them at all.
+	 */
+	bool IsIncludedInBuild() const;
+
 protected:
 	/** Called when an object is registered. Override to initialize logic. */
 	virtual void OnRegister() {}
@@ -98,6 +129,9 @@ public:
 	FORCEINLINE virtual bool CanEverTick() const { return bCanEverTick; }
 	FORCEINLINE virtual bool IsReadyToTick() const { return true; }
 
+	/** Returns the primary tick function, or nullptr if it hasn't been created (the object never registered to tick). */
+	FScriptableObjectTickFunction* GetPrimaryTickFunction() const { return PrimaryObjectTick.Get(); }
+
 protected:
 	/** Virtual call chain to register all tick functions */
 	virtual void RegisterTickFunctions(bool bRegister);
@@ -114,7 +148,7 @@ public:
 	FGuid GetBindingID() const { return BindingID; }
 
 	/** Injects the shared data from the owning container. */
-	virtual void InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap);
+	virtual void InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap);
 
 	/** Propagates the runtime data to a child object. */
 	void PropagateRuntimeData(UScriptableObject* Child) const;
@@ -122,11 +156,29 @@ public:
 	/** Resolves and applies bindings (copies data from sources to this object). */
 	void ResolveBindings();
 
-	const FInstancedPropertyBag* GetContext() const { return ContextRef; }
+	/** Returns the innermost Context bag with properties. Use GetContextScope() to also see structs and the enclosing scopes. */
+	const FInstancedPropertyBag* GetContext() const { return ContextScopeRef ? ContextScopeRef->FindFirstNonEmptyBag() : nullptr; }
+
+	/** Returns the Context scope chain available to this object. */
+	const FScriptableContextScope* GetContextScope() const { return ContextScopeRef; }
+
+	/** Returns the binding source map injected by the owning container. */
+	const TMap<FGuid, TObjectPtr<UScriptableObject>>* GetBindingSourceMap() const { return BindingsMapRef; }
 
 	/** Finds a registered task by its persistent ID. */
 	UScriptableObject* FindBindingSource(const FGuid& InID);
 
+	/**
+	 * Duplicates a template for runtime use. Bindings are immutable at runtime, so the copy (and its subobjects)
+	 * reference the template's binding lists instead of deep-copying them. Not for copies that are edited or saved.
+	 */
+	template<typename T>
+	static T* DuplicateForRuntime(const T* Template, UObject* Outer)
+	{
+		FScriptableSharedBindingsScope SharedBindingsScope;
+		return DuplicateObject<T>(Template, Outer);
+	}
+
 #if WITH_EDITOR
 	/** Accessor for the editor module to modify bindings directly. */
 	FScriptablePropertyBindings& GetPropertyBindings() { return PropertyBindings; }
@@ -141,6 +193,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category = Hidden, meta = (NoBinding))
 	uint8 bEnabled : 1 = true;
 
+	/** Configuration: builds this object is kept in. Set in the class defaults to filter a whole class. */
+	UPROPERTY(EditAnywhere, Category = "Build", AdvancedDisplay, meta = (NoBinding))
+	EScriptableNetTarget NetTarget = EScriptableNetTarget::All;
+
+	/** Configuration: stripped from shipping builds, and not cooked at all for them (see Scriptable.Cook.StripDevelopmentNodes). */
+	UPROPERTY(EditAnywhere, Category = "Build", AdvancedDisplay, meta = (NoBinding))
+	uint8 bDevelopmentOnly : 1 = false;
+
 	/** Configuration: Tick capability */
 	UPROPERTY(EditDefaultsOnly, Category = Tick, meta = (NoBinding))
 	uint8 bCanEverTick : 1 = false;
@@ -148,13 +208,19 @@ protected:
 	/** Runtime: Registration state */
 	uint8 bRegistered : 1 = false;
 
-	/** Main tick function for the object */
+	/** Configuration of the main tick function */
 	UPROPERTY(EditDefaultsOnly, Category = Tick, meta = (ShowOnlyInnerProperties, NoBinding))
-	FScriptableObjectTickFunction PrimaryObjectTick;
+	FScriptableObjectTickSettings PrimaryObjectTickSettings;
+
+#if WITH_EDITORONLY_DATA
+	/** Deprecated: the settings moved to PrimaryObjectTickSettings, customized values are copied over in PostLoad. */
+	UPROPERTY(meta = (DeprecatedProperty, NoBinding))
+	FScriptableObjectTickFunction PrimaryObjectTick_DEPRECATED;
+#endif
 
 private:
 	/** Input data (Context) available for this object and its children. */
-	const FInstancedPropertyBag* ContextRef = nullptr;
+	const FScriptableContextScope* ContextScopeRef = nullptr;
 
 	/** Reference to the Action's Binding Source Map. */
 	const TMap<FGuid, TObjectPtr<UScriptableObject>>* BindingsMapRef = nullptr;
@@ -167,12 +233,21 @@ private:
 	UPROPERTY(meta = (NoBinding))
 	FScriptablePropertyBindings PropertyBindings;
 
+	/** Context lookups of PropertyBindings for the current registration. */
+	FScriptableBindingCache BindingCache;
+
+	/** Main tick function for the object. Allocated on first registration, only for objects that can tick. */
+	TUniquePtr<FScriptableObjectTickFunction> PrimaryObjectTick;
+
 	/** Cached pointers */
 	UObject* OwnerPrivate = nullptr;
 	UWorld* WorldPrivate = nullptr;
-	FDelegateHandle OnWorldBeginTearDownHandle;
+
+	/** Registry tracking this object, and our slot in it, while registered. */
+	TWeakObjectPtr<UScriptableObjectRegistry> Registry;
+	int32 RegistryIndex = INDEX_NONE;
 
 	/** Internal helpers */
 	UWorld* GetWorld_Uncached() const;
-	void OnWorldBeginTearDown(UWorld* InWorld);
+	void RemoveFromRegistry();
 };
\ No newline at end of file
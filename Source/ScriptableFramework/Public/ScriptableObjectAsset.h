@@ -16,6 +16,13 @@ class SCRIPTABLEFRAMEWORK_API UScriptableObjectAsset : public UObject
 	GENERATED_BODY()
 
 public:
+	/**
+	 * Opt-in (Scriptable.GC.ClusterAssets): a loaded asset and all its instanced tasks/conditions form a single GC cluster.
+	 * The GC doesn't see references written into cluster members after creation, so this is only safe for projects
+	 * that never register the asset's own containers (e.g. EvaluateRequirement/RunAction directly on the asset).
+	 */
+	virtual bool CanBeClusterRoot() const override;
+
 #if WITH_EDITORONLY_DATA
 	/** Category used for organization in the editor picker (e.g. "Combat|Melee"). */
 	UPROPERTY(EditDefaultsOnly, Category = "Config", meta = (AssetRegistrySearchable))
@@ -0,0 +1,48 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScriptableObjectRegistry.generated.h"
+
+class UScriptableObject;
+
+/**
+ * Tracks every scriptable object registered with a world.
+ * Objects live in a dense array and remember their slot, so adding and removing them is O(1).
+ * When the world is torn down, all remaining objects are unregistered in one pass.
+ * 
+ * Other per-world services (UScriptableActionScheduler, UScriptableActionPool) are separate subsystems.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableObjectRegistry final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Adds an object to the registry. Called by UScriptableObject::RegisterObjectWithWorld. */
+	void AddObject(UScriptableObject* Object);
+
+	/** Removes an object from the registry. Called by UScriptableObject::Unregister. */
+	void RemoveObject(UScriptableObject* Object);
+
+	/** Number of objects currently registered with this world. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Registry")
+	int32 GetNumRegisteredObjects() const { return RegisteredObjects.Num(); }
+
+private:
+	void OnWorldBeginTearDown(UWorld* InWorld);
+
+	/** Unregisters every tracked object. */
+	void UnregisterAll();
+
+	/** Registered objects. Weak, registration doesn't keep an object alive. */
+	TArray<TWeakObjectPtr<UScriptableObject>> RegisteredObjects;
+
+	FDelegateHandle OnWorldBeginTearDownHandle;
+};
@@ -11,6 +11,55 @@
 
 class UScriptableObject;
 
+/** Which side of a networked game a scriptable object is kept for. */
+UENUM()
+enum class EScriptableNetTarget : uint8
+{
+	/** Kept everywhere. */
+	All,
+
+	/** Stripped from client-only builds and cooks (e.g. authority logic). */
+	ServerOnly,
+
+	/** Stripped from dedicated server builds and cooks (e.g. cosmetic tasks). */
+	ClientOnly,
+};
+
+/**
+ * Editable tick configuration of a scriptable object.
+ * Kept separate from the tick function itself, which is only allocated for objects that actually tick.
+ */
+USTRUCT()
+struct FScriptableObjectTickSettings
+{
+	GENERATED_BODY()
+
+	/** Defines the minimum tick group for this tick function. */
+	UPROPERTY(EditDefaultsOnly, Category = "Tick", AdvancedDisplay)
+	TEnumAsByte<ETickingGroup> TickGroup = TG_PrePhysics;
+
+	/** The frequency in seconds at which this tick function will be executed. If less than or equal to 0 then it will tick every frame. */
+	UPROPERTY(EditDefaultsOnly, Category = "Tick", meta = (DisplayName = "Tick Interval (secs)"))
+	float TickInterval = 0.f;
+
+	/** If true, this tick function will start enabled, but can be disabled later on. */
+	UPROPERTY(EditDefaultsOnly, Category = "Tick")
+	uint8 bStartWithTickEnabled : 1 = true;
+
+	/** Bool indicating that this function should execute even if the game is paused. */
+	UPROPERTY(EditDefaultsOnly, Category = "Tick", AdvancedDisplay)
+	uint8 bTickEvenWhenPaused : 1 = false;
+
+	/** Copies the settings into a tick function before it is registered. */
+	void ApplyTo(FTickFunction& TickFunction) const
+	{
+		TickFunction.TickGroup = TickGroup;
+		TickFunction.TickInterval = TickInterval;
+		TickFunction.bStartWithTickEnabled = bStartWithTickEnabled;
+		TickFunction.bTickEvenWhenPaused = bTickEvenWhenPaused;
+	}
+};
+
 /** Tick function that calls UScriptableObject::Tick */
 USTRUCT()
 struct FScriptableObjectTickFunction : public FTickFunction
@@ -4,10 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableContainer.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
+#include "Engine/TimerHandle.h"
 #include "ScriptableAction.generated.h"
 
 class UScriptableObject;
 class UScriptableTask;
+class UScriptableActionScheduler;
+class UWorld;
 
 DECLARE_MULTICAST_DELEGATE(FScriptableActionNativeDelegate);
 
@@ -22,6 +26,34 @@ enum class EScriptableActionMode : uint8
 	Parallel,
 };
 
+/** Units of work an action can hand over to the UScriptableActionScheduler. */
+enum class EScriptableScheduledWork : uint8
+{
+	/** Starts the action's tasks. */
+	Begin,
+
+	/** Starts the next task of a Sequence. */
+	SequenceStep,
+};
+
+/**
+ * Bookkeeping for work queued outside the action (scheduler entries, next-tick timers).
+ * Those entries point at the action's address, so a copy never inherits them: it starts clean.
+ */
+struct FScriptableActionPendingWork
+{
+	/** Scheduler holding our queued work, if any. */
+	TWeakObjectPtr<UScriptableActionScheduler> Scheduler;
+
+	/** Pending next-tick timer for the remaining Parallel task starts, and the world it was set on. */
+	FTimerHandle ParallelStartTimerHandle;
+	TWeakObjectPtr<UWorld> TimerWorld;
+
+	FScriptableActionPendingWork() = default;
+	FScriptableActionPendingWork(const FScriptableActionPendingWork&) {}
+	FScriptableActionPendingWork& operator=(const FScriptableActionPendingWork&) { return *this; }
+};
+
 /**
  * A container struct that holds a list of tasks, defines their execution flow,
  * and acts as the "Root" execution context (holding shared data and bindings).
@@ -47,10 +79,63 @@ public:
 	UPROPERTY(EditAnywhere, Instanced, Category = "Tasks")
 	TArray<TObjectPtr<UScriptableTask>> Tasks;
 
+	/**
+	 * Lightweight struct-based tasks (see FScriptableTaskNode).
+	 * They run after the object tasks, using the same execution mode.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Tasks", meta = (BaseStruct = "/Script/ScriptableFramework.ScriptableTaskNode", ExcludeBaseStruct))
+	TArray<FInstancedStruct> TaskNodes;
+
+	/**
+	 * Sequence only: tasks are registered with the world when the sequence reaches them
+	 * and unregistered as soon as they finish, instead of all being registered up front.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Scheduling", meta = (EditCondition = "Mode == EScriptableActionMode::Sequence"))
+	uint8 bLazyTaskRegistration : 1 = false;
+
+	/**
+	 * If true, Begin and Sequence steps are queued on the world's UScriptableActionScheduler
+	 * and executed under its per-frame budget instead of immediately.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Scheduling")
+	uint8 bTimeSliced : 1 = false;
+
+	/** Priority inside the scheduler queue. Higher values run first. */
+	UPROPERTY(EditAnywhere, Category = "Scheduling", meta = (EditCondition = "bTimeSliced"))
+	int32 SchedulePriority = 0;
+
+	/**
+	 * Parallel only: spreads task starts evenly across this many frames.
+	 * 0 or 1 begins every task in the same frame.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Scheduling", meta = (ClampMin = 0, EditCondition = "Mode == EScriptableActionMode::Parallel"))
+	int32 StartupFrameSpread = 0;
+
+	/** Parallel only: maximum number of tasks to begin per frame. 0 means no limit. */
+	UPROPERTY(EditAnywhere, Category = "Scheduling", meta = (ClampMin = 0, EditCondition = "Mode == EScriptableActionMode::Parallel"))
+	int32 MaxTaskStartsPerFrame = 0;
+
 	FScriptableActionNativeDelegate OnActionBegin;
 	FScriptableActionNativeDelegate OnActionFinish;
 
 private:
+	/** Work waiting in the scheduler queue or on a timer. Not copied. */
+	FScriptableActionPendingWork PendingWork;
+
+	/** Parallel mode: index of the next task to begin when starts are spread across frames. */
+	int32 NextParallelTaskIndex = 0;
+
+	/**
+	 * Lazy registration only: outer of the runtime task copies. When set, Tasks may still point at the
+	 * asset's templates, and each one is duplicated here the first time the sequence reaches it (see SetLazyTaskOuter).
+	 */
+	UPROPERTY(Transient)
+	TObjectPtr<UObject> LazyTaskOuter;
+
+	/** Runtime state of each entry in TaskNodes. */
+	UPROPERTY(Transient)
+	TArray<FScriptableTaskNodeRuntime> TaskNodeRuntime;
+
 	/** The index of the currently running task (used in Sequence mode). */
 	UPROPERTY(Transient)
 	int32 CurrentTaskIndex = 0;
@@ -59,6 +144,10 @@ private:
 	UPROPERTY(Transient)
 	bool bIsRunning = false;
 
+	/** True between Register and Unregister. */
+	UPROPERTY(Transient)
+	bool bIsRegistered = false;
+
 	// -------------------------------------------------------------------
 	// API
 	// -------------------------------------------------------------------
@@ -77,17 +166,83 @@ public:
 	/** Starts the execution of the action. */
 	void Begin();
 
+	/**
+	 * Warm restart of an already registered action.
+	 * Keeps registration, binding map and task instances intact and only resets
+	 * the runtime state (task index, task status, loop counters) before calling Begin.
+	 */
+	void Restart();
+
 	/** Finish the execution immediately. */
 	void Finish();
 
 	/** Returns true if the action is currently executing. */
 	bool IsRunning() const { return bIsRunning; }
 
+	/** Returns true if the action has been registered with an owner. */
+	bool IsRegistered() const { return bIsRegistered; }
+
+	/** Returns the number of object tasks plus struct tasks. */
+	int32 GetNumTasks() const { return Tasks.Num() + TaskNodes.Num(); }
+
+	/** Returns true if tasks are registered just in time instead of during Register. */
+	bool UsesLazyTaskRegistration() const { return bLazyTaskRegistration && Mode == EScriptableActionMode::Sequence; }
+
+	/**
+	 * For runtime copies whose Tasks still reference the asset's templates: each task is duplicated into
+	 * Outer when first begun, so only the tasks that actually run are instantiated. Requires lazy registration.
+	 */
+	void SetLazyTaskOuter(UObject* Outer);
+
+	/** Returns true if the task at Index is still an uninstantiated template (see SetLazyTaskOuter). */
+	bool IsTaskTemplate(int32 Index) const;
+
 private:
-	void BeginSubTask(UScriptableTask* Task);
+	friend class UScriptableTask;
+	friend class UScriptableActionScheduler;
+	friend struct FScriptableTaskNodeHandle;
+
+	void BeginSubTask(int32 TaskIndex);
+
+	/** Replaces the template at TaskIndex with its runtime copy. */
+	UScriptableTask* InstantiateTask(int32 TaskIndex);
 	void OnSubTaskFinished(UScriptableTask* Task);
 
+	/** Begins the struct task at NodeIndex (an index into TaskNodes). */
+	void BeginTaskNode(int32 NodeIndex);
+
+	/** Finishes a running struct task. Notifies the action unless bForced. */
+	void FinishTaskNode(int32 NodeIndex, bool bForced);
+
+	FScriptableTaskNodeContext MakeTaskNodeContext(int32 NodeIndex);
+
+	/** Stops tracking running struct tasks and restores their instance data to defaults. */
+	void ResetTaskNodeRuntime();
+
+	/** Starts the tasks right away, bypassing the scheduler. */
+	void BeginImmediate();
+
+	/** Parallel mode: begins the next batch of tasks and defers the rest to the next frame. */
+	void BeginParallelBatch();
+
+	/** Number of Parallel tasks to begin per frame, based on StartupFrameSpread and MaxTaskStartsPerFrame. */
+	int32 GetParallelBatchSize() const;
+
+	void ClearParallelStartTimer();
+
+	/** Hands the work over to the world scheduler. Returns false if it must run inline. */
+	bool TrySchedule(EScriptableScheduledWork Work);
+
+	/** Removes any pending work from the scheduler queue. */
+	void CancelScheduledWork();
+
+	/** Called by the scheduler when queued work is due. */
+	void ExecuteScheduledWork(EScriptableScheduledWork Work);
+
 public:
-	/** Static entry point to run an action. Handles registration and startup. */
+	/**
+	 * Static entry point to run an action. Handles registration and startup.
+	 * Actions already registered with the same owner take the Restart path.
+	 */
 	static void RunAction(UObject* Owner, FScriptableAction& Action);
 };
\ No newline at end of file
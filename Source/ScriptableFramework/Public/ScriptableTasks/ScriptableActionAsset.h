@@ -19,6 +19,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Action")
 	FScriptableAction Action;
 
+	/** Number of runtime instances created up front in each world's UScriptableActionPool the first time this asset runs. */
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = 0))
+	int32 PoolPrewarmCount = 0;
+
 protected:
 	virtual FInstancedPropertyBag* GetContext() override { return &Action.GetContext(); }
 
@@ -36,33 +40,55 @@ class SCRIPTABLEFRAMEWORK_API UScriptableTask_RunAsset final : public UScriptabl
 	GENERATED_BODY()
 
 public:
-	/** The asset containing the Action definition (Context + Tasks) to run. */
+	/** The asset containing the Action definition (Context + Tasks) to run. Cleared in cooked data once the action is inlined. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ScriptableTask)
 	TObjectPtr<class UScriptableActionAsset> Asset;
 
 protected:
 	/**
-	 * The runtime instance of the action.
+	 * The runtime instance of the action, borrowed from the world's UScriptableActionPool.
 	 * This holds the unique state (Context memory, Task instances) for this execution.
 	 */
 	UPROPERTY(Transient)
-	FScriptableAction RuntimeAction;
+	TObjectPtr<class UScriptableActionInstance> RuntimeInstance;
+
+	/**
+	 * Cooked copy of the asset's action, with its tasks owned by this task (see InlineReferencedAssets).
+	 * When present it runs in place of a pooled instance.
+	 */
+	UPROPERTY()
+	FScriptableAction InlinedAction;
+
+	/** The asset's Context as it was cooked, restored into InlinedAction after each run. */
+	UPROPERTY()
+	FInstancedPropertyBag InlinedContextDefaults;
+
+	UPROPERTY()
+	uint8 bHasInlinedAction : 1 = false;
 
 public:
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
+	virtual void InitRuntimeData(const FScriptableContextScope* InContextScope, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap) override;
 	virtual void ResetTask() override;
 	virtual void BeginTask() override;
 	virtual void FinishTask() override;
 
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
+	virtual void InlineReferencedAssets(TArray<const UObject*>& AssetStack) override;
 #endif
 
 private:
 	/** Creates a runtime copy of the Action defined in the Asset. */
 	void InstantiateRuntimeAction();
 
-	/** Cleans up the runtime action. */
+	/** Cleans up the runtime action and returns it to the pool. */
 	void TeardownRuntimeAction();
+
+	/** Returns the runtime action, or nullptr if none is instantiated. */
+	FScriptableAction* GetRuntimeAction() const;
+
+	/** Finishes this task once the inner action completes. */
+	void OnRuntimeActionFinished();
 };
\ No newline at end of file
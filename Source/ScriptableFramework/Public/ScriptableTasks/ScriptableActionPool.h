@@ -0,0 +1,90 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScriptableTasks/ScriptableAction.h"
+#include "ScriptableActionPool.generated.h"
+
+class UScriptableActionAsset;
+
+/**
+ * Runtime instance of an Action Asset.
+ * Owns the copied Action struct and its duplicated tasks, giving them a stable address while in use or pooled.
+ */
+UCLASS(Transient)
+class SCRIPTABLEFRAMEWORK_API UScriptableActionInstance final : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** The asset this instance was created from. */
+	UPROPERTY()
+	TObjectPtr<const UScriptableActionAsset> Asset;
+
+	/** The runtime copy of the asset's action. Tasks are owned by this instance. */
+	UPROPERTY()
+	FScriptableAction Action;
+
+	/** Creates a new, unpooled instance of the asset's action. */
+	static UScriptableActionInstance* Create(UObject* Outer, const UScriptableActionAsset* InAsset);
+};
+
+/** Free instances of a single asset. */
+USTRUCT()
+struct FScriptableActionInstanceList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UScriptableActionInstance>> FreeInstances;
+
+	/** True once the asset's PoolPrewarmCount instances have been created. */
+	bool bPrewarmed = false;
+};
+
+/**
+ * Per-world pool of Action Asset instances used by UScriptableTask_RunAsset.
+ * Hands out pre-duplicated runtime actions and takes them back on teardown after a cheap reset,
+ * so running an asset doesn't duplicate its whole task list every time.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableActionPool final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Creates instances until the asset has at least Count free instances. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Pool")
+	void Prewarm(const UScriptableActionAsset* Asset, int32 Count);
+
+	/** Returns a free instance of the asset, creating one if the pool is empty. */
+	UScriptableActionInstance* Acquire(const UScriptableActionAsset* Asset);
+
+	/**
+	 * Returns an unregistered instance to the pool.
+	 * Instances beyond the per-asset cap (Scriptable.ActionPool.MaxFreePerAsset, or the asset's PoolPrewarmCount if higher) are left to the GC.
+	 */
+	void Release(UScriptableActionInstance* Instance);
+
+	/** Drops every free instance, leaving them to the GC. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Pool")
+	void Trim();
+
+	/** Number of free instances currently pooled for the asset. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Pool")
+	int32 GetNumFree(const UScriptableActionAsset* Asset) const;
+
+	/** Acquires from the world's pool, or creates an unpooled instance if there is none (e.g. no world). */
+	static UScriptableActionInstance* AcquireInstance(UWorld* World, const UScriptableActionAsset* Asset, UObject* FallbackOuter);
+
+	/** Releases to the world's pool. Unpooled instances are left to the GC. */
+	static void ReleaseInstance(UWorld* World, UScriptableActionInstance* Instance);
+
+private:
+	UPROPERTY()
+	TMap<TObjectPtr<const UScriptableActionAsset>, FScriptableActionInstanceList> Pools;
+};
@@ -0,0 +1,88 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScriptableTasks/ScriptableAction.h"
+#include "ScriptableActionScheduler.generated.h"
+
+/** Snapshot of the scheduler state, used to tune the per-frame budget. */
+USTRUCT(BlueprintType)
+struct SCRIPTABLEFRAMEWORK_API FScriptableActionSchedulerStats
+{
+	GENERATED_BODY()
+
+	/** Number of work items still waiting in the queue. */
+	UPROPERTY(BlueprintReadOnly, Category = "Scheduler")
+	int32 QueueDepth = 0;
+
+	/** Number of work items executed during the last frame. */
+	UPROPERTY(BlueprintReadOnly, Category = "Scheduler")
+	int32 ProcessedLastFrame = 0;
+
+	/** Time spent executing work during the last frame, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Scheduler")
+	float TimeSpentLastFrameMs = 0.f;
+
+	/** Smoothed time between a work item being queued and executed, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Scheduler")
+	float AverageLatencyMs = 0.f;
+
+	/** Largest queue latency observed during the last frame, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Scheduler")
+	float MaxLatencyLastFrameMs = 0.f;
+};
+
+/**
+ * World-level scheduler for time-sliced actions.
+ * Actions with bTimeSliced enabled queue their Begin and Sequence steps here instead of running them inline.
+ * The queue is drained every frame in priority order until the budget (Scriptable.Scheduler.BudgetMs) is spent.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableActionScheduler final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queues a unit of work for the given action. */
+	void Enqueue(FScriptableAction& Action, EScriptableScheduledWork Work);
+
+	/** Removes any pending work for the given action. */
+	void Cancel(const FScriptableAction& Action);
+
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Scheduler")
+	FScriptableActionSchedulerStats GetStats() const { return Stats; }
+
+private:
+	struct FScheduledItem
+	{
+		FScriptableAction* Action = nullptr;
+
+		/** Object owning Action. Entries whose owner died without unregistering the action are dropped. */
+		TWeakObjectPtr<UObject> Owner;
+
+		EScriptableScheduledWork Work = EScriptableScheduledWork::Begin;
+		int32 Priority = 0;
+		uint64 Serial = 0;
+		double EnqueueTime = 0.0;
+	};
+
+	/** Heap predicate: higher priority first, FIFO within the same priority. */
+	struct FScheduledItemPredicate
+	{
+		bool operator()(const FScheduledItem& A, const FScheduledItem& B) const
+		{
+			return A.Priority != B.Priority ? A.Priority > B.Priority : A.Serial < B.Serial;
+		}
+	};
+
+	TArray<FScheduledItem> Queue;
+	uint64 NextSerial = 0;
+
+	FScriptableActionSchedulerStats Stats;
+};
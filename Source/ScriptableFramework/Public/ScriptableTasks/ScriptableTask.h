@@ -10,6 +10,7 @@ SCRIPTABLEFRAMEWORK_API DECLARE_LOG_CATEGORY_EXTERN(LogScriptableTask, Log, All)
 
 class UScriptableTask;
 class UScriptableCondition;
+struct FScriptableAction;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FScriptableTaskNativeDelegate, UScriptableTask* /*Task*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FScriptableTaskDelegate, UScriptableTask*, Task);
@@ -50,6 +51,8 @@ class SCRIPTABLEFRAMEWORK_API UScriptableTask : public UScriptableObject
 {
 	GENERATED_BODY()
 
+	friend struct FScriptableAction;
+
 private:
 	/** Current status of the task. */
 	EScriptableTaskStatus Status = EScriptableTaskStatus::None;
@@ -66,6 +69,9 @@ private:
 	UPROPERTY(Transient)
 	uint8 bDoOnceFinished : 1 = false;
 
+	/** The action currently running this task. Notified directly on finish, bypassing the delegates. */
+	FScriptableAction* ParentAction = nullptr;
+
 public:
 	EScriptableTaskStatus GetStatus() const { return Status; }
 
@@ -104,6 +110,18 @@ public:
 	FScriptableTaskDelegate OnTaskFinish;
 
 private:
+	/** Notifies the parent action and any external listeners that this task has finished. */
+	void NotifyFinished();
+
+	/** Clears status and loop counters without calling ResetTask. Used by FScriptableAction::Restart. */
+	void ResetRuntimeState();
+
+	/**
+	 * Unbinds all listeners. Called when the owning action is torn down, not on Unregister:
+	 * lazily registered tasks are unregistered after every run and must keep their listeners.
+	 */
+	void ClearDelegates();
+
 	virtual void ResetTask();
 	virtual void BeginTask();
 	virtual void FinishTask();
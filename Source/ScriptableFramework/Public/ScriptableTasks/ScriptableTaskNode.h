@@ -0,0 +1,109 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
+#include "ScriptableContextScope.h"
+#include "ScriptableTaskNode.generated.h"
+
+struct FScriptableAction;
+
+/** Result of beginning a struct task. */
+enum class EScriptableTaskNodeResult : uint8
+{
+	/** The task is done, the action moves on immediately. */
+	Finished,
+
+	/** The task keeps running until FScriptableTaskNodeHandle::Finish is called. */
+	Running,
+};
+
+/**
+ * Identifies a running struct task, so latent work can finish it later.
+ * Handles become stale once the task finishes or the action is restarted.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskNodeHandle
+{
+	FScriptableAction* Action = nullptr;
+
+	/** Object running the action. Action is only touched while it is alive. */
+	TWeakObjectPtr<UObject> Owner;
+
+	int32 NodeIndex = INDEX_NONE;
+	uint32 RunSerial = 0;
+
+	bool IsValid() const { return Action != nullptr && NodeIndex != INDEX_NONE && Owner.IsValid(); }
+
+	/** Finishes the task. Does nothing if the handle is stale. */
+	void Finish() const;
+};
+
+/** Per-run state handed to a struct task. */
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskNodeContext
+{
+	/** The object running the action. */
+	UObject* Owner = nullptr;
+
+	/** Context of the action. */
+	const FScriptableContextScope* Context = nullptr;
+
+	/** Mutable state of this task, of the type returned by GetInstanceDataType(). */
+	FStructView InstanceData;
+
+	/** Handle used to finish a Running task later. */
+	FScriptableTaskNodeHandle Handle;
+
+	/** Typed access to the instance data. */
+	template<typename T>
+	T& GetInstanceData() const
+	{
+		return InstanceData.Get<T>();
+	}
+
+	/** Reads a value from the Context, or returns a default value if it is missing. */
+	template<typename T>
+	T GetContextValue(const FName& Name) const
+	{
+		return Context ? Context->GetValue<T>(Name) : T();
+	}
+};
+
+/**
+ * Base struct for lightweight, struct-based tasks.
+ * Stored as FInstancedStruct in FScriptableAction::TaskNodes: no UObject, no GC tracking and no tick function.
+ * Nodes are shared and read-only at runtime; mutable state goes into the struct returned by GetInstanceDataType().
+ */
+USTRUCT(meta = (Hidden))
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskNode
+{
+	GENERATED_BODY()
+
+	virtual ~FScriptableTaskNode() = default;
+
+	/** Returns the per-instance state struct of this node, or nullptr if it is stateless. */
+	virtual const UScriptStruct* GetInstanceDataType() const { return nullptr; }
+
+	/** Called when the task begins. Return Running to finish later through the context handle. */
+	virtual EScriptableTaskNodeResult Begin(const FScriptableTaskNodeContext& Context) const { return EScriptableTaskNodeResult::Finished; }
+
+	/** Called when the task finishes, either on its own or because the action was stopped. */
+	virtual void Finish(const FScriptableTaskNodeContext& Context) const {}
+};
+
+/** Runtime state of a struct task inside an action. */
+USTRUCT()
+struct FScriptableTaskNodeRuntime
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	FInstancedStruct InstanceData;
+
+	/** Incremented on every Begin so stale handles can be detected. */
+	uint32 RunSerial = 0;
+
+	/** True between Begin and Finish. */
+	bool bRunning = false;
+};
@@ -21,6 +21,8 @@ class SCRIPTABLEFRAMEWORK_API UScriptableTask_LogMessage : public UScriptableTas
 	GENERATED_BODY()
 
 public:
+	UScriptableTask_LogMessage();
+
 	/** The message string to print. */
 	UPROPERTY(EditAnywhere, Category = "Config")
 	FString Message = TEXT("Hello");
@@ -8,6 +8,7 @@
 #include "Templates/UnrealTemplate.h"
 #include "Templates/EnableIf.h"
 #include "Concepts/BaseStructureProvider.h"
+#include "UObject/EnumProperty.h"
 
 namespace ScriptablePropertyBag
 {
@@ -27,12 +28,60 @@ namespace ScriptablePropertyBag
 		template <typename T> struct TIsSoftClassPtr<TSoftClassPtr<T>> { enum { Value = true }; };
 		template <typename T> struct TIsSoftClassPtr<const TSoftClassPtr<T>> { enum { Value = true }; };
 
+		/**
+		 * Adds the property only if it is missing or has a different type.
+		 * AddProperty rebuilds the bag layout even when the property already exists, which is too slow for per-frame writes.
+		 */
+		static void EnsureProperty(FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType)
+		{
+			const FPropertyBagPropertyDesc* Desc = Bag.FindPropertyDescByName(Name);
+			if (!Desc || Desc->ValueType != Type || Desc->ValueTypeObject != ObjectType || Desc->ContainerTypes.Num() > 0)
+			{
+				Bag.AddProperty(Name, Type, ObjectType);
+			}
+		}
+
+		/** Same as EnsureProperty, for a property holding an array of the given type. */
+		static void EnsureArrayProperty(FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType)
+		{
+			const FPropertyBagPropertyDesc* Desc = Bag.FindPropertyDescByName(Name);
+			if (!Desc || Desc->ValueType != Type || Desc->ValueTypeObject != ObjectType || Desc->ContainerTypes.Num() != 1 || Desc->ContainerTypes.GetFirstContainerType() != EPropertyBagContainerType::Array)
+			{
+				Bag.AddContainerProperty(Name, EPropertyBagContainerType::Array, Type, ObjectType);
+			}
+		}
+
+		/**
+		 * Element types that can be viewed in place: the bag stores them with the exact C++ layout.
+		 * Object pointers (stored as TObjectPtr) and enums (stored through their underlying property) are excluded.
+		 */
+		template <typename T>
+		constexpr bool TIsViewableArrayElement = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !TIsEnum<T>::Value;
+
+		/** Checks that the property is an array of T, without touching its memory. */
+		template <typename T, typename TraitsType>
+		static EPropertyBagResult CheckArrayType(const FInstancedPropertyBag& Bag, const FName& Name)
+		{
+			const FPropertyBagPropertyDesc* Desc = Bag.FindPropertyDescByName(Name);
+			if (!Desc)
+			{
+				return EPropertyBagResult::PropertyNotFound;
+			}
+
+			if (Desc->ValueType != TraitsType::Type || Desc->ValueTypeObject != TraitsType::GetObjectType() || Desc->ContainerTypes.Num() != 1 || Desc->ContainerTypes.GetFirstContainerType() != EPropertyBagContainerType::Array)
+			{
+				return EPropertyBagResult::TypeMismatch;
+			}
+
+			return EPropertyBagResult::Success;
+		}
+
 		/**
 		 * Helper to get a typed array from the bag.
 		 * Reduces boilerplate in the specializations below.
 		 */
-		template<typename T>
-		static TValueOrError<TArray<T>, EPropertyBagResult> GetValueArray(const FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType, TFunction<T(const FPropertyBagArrayRef&, const int32)> GetValueFunc)
+		template<typename T, typename GetValueFuncType>
+		static TValueOrError<TArray<T>, EPropertyBagResult> GetValueArray(const FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType, const GetValueFuncType& GetValueFunc)
 		{
 			TValueOrError<const FPropertyBagArrayRef, EPropertyBagResult> ArrayOrError = Bag.GetArrayRef(Name);
 			if (ArrayOrError.HasError())
@@ -62,9 +111,10 @@ namespace ScriptablePropertyBag
 		 * Helper to set a typed array in the bag.
 		 * Automatically adds the property if missing and fills values.
 		 */
-		static void SetValueArray(FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType, const int32 Num, TFunction<void(FPropertyBagArrayRef&, const int32)> SetValueFunc)
+		template<typename SetValueFuncType>
+		static void SetValueArray(FInstancedPropertyBag& Bag, const FName& Name, EPropertyBagPropertyType Type, const UObject* ObjectType, const int32 Num, const SetValueFuncType& SetValueFunc)
 		{
-			Bag.AddContainerProperty(Name, EPropertyBagContainerType::Array, Type, ObjectType);
+			EnsureArrayProperty(Bag, Name, Type, ObjectType);
 
 			TValueOrError<FPropertyBagArrayRef, EPropertyBagResult> ArrayOrError = Bag.GetMutableArrayRef(Name);
 			if (ArrayOrError.HasValue())
@@ -101,7 +151,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, bool bValue)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueBool(Name, bValue);
 		}
 	};
@@ -120,7 +170,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, int32 Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueInt32(Name, Value);
 		}
 	};
@@ -139,7 +189,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, int64 Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueInt64(Name, Value);
 		}
 	};
@@ -158,7 +208,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, uint8 Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueByte(Name, Value);
 		}
 	};
@@ -177,7 +227,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, float Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueFloat(Name, Value);
 		}
 	};
@@ -196,7 +246,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, double Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueDouble(Name, Value);
 		}
 	};
@@ -215,7 +265,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, const FName& Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueName(Name, Value);
 		}
 	};
@@ -234,7 +284,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, const FString& Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueString(Name, Value);
 		}
 	};
@@ -253,7 +303,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, const FText& Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueText(Name, Value);
 		}
 	};
@@ -272,7 +322,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, const TPropertyType& Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueEnum(Name, Value);
 		}
 	};
@@ -302,7 +352,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, const TPropertyType& Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueStruct(Name, Value);
 		}
 	};
@@ -321,7 +371,7 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, TPropertyType* Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueObject(Name, Value);
 		}
 	};
@@ -340,11 +390,56 @@ namespace ScriptablePropertyBag
 
 		static void SetValue(FInstancedPropertyBag& Bag, const FName& Name, TPropertyType* Value)
 		{
-			Bag.AddProperty(Name, Type, GetObjectType());
+			Private::EnsureProperty(Bag, Name, Type, GetObjectType());
 			Bag.SetValueObject(Name, Value);
 		}
 	};
 
+	namespace Private
+	{
+		/**
+		 * Reads a single value of type T from any struct memory (bag or regular USTRUCT).
+		 * The property must match what a bag would declare for T. Returns false on a type mismatch.
+		 */
+		template<typename T>
+		static bool ReadPropertyValue(const FProperty* Property, const void* ContainerMemory, T& OutValue)
+		{
+			const FPropertyBagPropertyDesc Desc(Property->GetFName(), Property);
+			if (Desc.ValueType != TPropertyBagType<T>::Type || Desc.ValueTypeObject != TPropertyBagType<T>::GetObjectType() || Desc.ContainerTypes.Num() != 0)
+			{
+				return false;
+			}
+
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ContainerMemory);
+
+			if constexpr (std::is_pointer_v<T>)
+			{
+				OutValue = Cast<std::remove_pointer_t<T>>(CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(ValuePtr));
+			}
+			else if constexpr (TIsEnum<T>::Value)
+			{
+				if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+				{
+					OutValue = static_cast<T>(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+				}
+				else
+				{
+					OutValue = static_cast<T>(CastFieldChecked<FNumericProperty>(Property)->GetSignedIntPropertyValue(ValuePtr));
+				}
+			}
+			else if constexpr (std::is_same_v<T, bool>)
+			{
+				OutValue = CastFieldChecked<FBoolProperty>(Property)->GetPropertyValue(ValuePtr);
+			}
+			else
+			{
+				OutValue = *static_cast<const T*>(ValuePtr);
+			}
+
+			return true;
+		}
+	}
+
 	// ------------------------------------------------------------------------------------------------
 	// Public Helper API
 	// ------------------------------------------------------------------------------------------------
@@ -380,4 +475,82 @@ namespace ScriptablePropertyBag
 		Bag.AddProperty(Name, TPropertyBagType<T>::Type, TPropertyBagType<T>::GetObjectType());
 	}
 
+	// ------------------------------------------------------------------------------------------------
+	// Array Views
+	// ------------------------------------------------------------------------------------------------
+
+	/**
+	 * Read-only view over an array property, pointing directly into the bag's memory (no allocation).
+	 * Only for trivially copyable element types, see Private::TIsViewableArrayElement.
+	 * The view is invalidated by any change to the array or to the bag layout.
+	 * Usage: TConstArrayView<float> Weights = ScriptablePropertyBag::GetArrayView<float>(MyBag, "Weights").GetValue();
+	 */
+	template <typename T>
+	TValueOrError<TConstArrayView<T>, EPropertyBagResult> GetArrayView(const FInstancedPropertyBag& Bag, const FName& Name)
+	{
+		static_assert(Private::TIsViewableArrayElement<T>, "Array views are only available for trivially copyable element types.");
+
+		const EPropertyBagResult TypeResult = Private::CheckArrayType<T, TPropertyBagType<T>>(Bag, Name);
+		if (TypeResult != EPropertyBagResult::Success)
+		{
+			return MakeError(TypeResult);
+		}
+
+		TValueOrError<const FPropertyBagArrayRef, EPropertyBagResult> ArrayOrError = Bag.GetArrayRef(Name);
+		if (ArrayOrError.HasError())
+		{
+			return MakeError(ArrayOrError.GetError());
+		}
+
+		const FPropertyBagArrayRef& ArrayRef = ArrayOrError.GetValue();
+		const int32 Num = ArrayRef.Num();
+		return MakeValue(TConstArrayView<T>(Num > 0 ? reinterpret_cast<const T*>(ArrayRef.GetRawPtr(0)) : nullptr, Num));
+	}
+
+	/** Mutable version of GetArrayView. Elements can be written in place, the array can't be resized through the view. */
+	template <typename T>
+	TValueOrError<TArrayView<T>, EPropertyBagResult> GetMutableArrayView(FInstancedPropertyBag& Bag, const FName& Name)
+	{
+		static_assert(Private::TIsViewableArrayElement<T>, "Array views are only available for trivially copyable element types.");
+
+		const EPropertyBagResult TypeResult = Private::CheckArrayType<T, TPropertyBagType<T>>(Bag, Name);
+		if (TypeResult != EPropertyBagResult::Success)
+		{
+			return MakeError(TypeResult);
+		}
+
+		TValueOrError<FPropertyBagArrayRef, EPropertyBagResult> ArrayOrError = Bag.GetMutableArrayRef(Name);
+		if (ArrayOrError.HasError())
+		{
+			return MakeError(ArrayOrError.GetError());
+		}
+
+		FPropertyBagArrayRef& ArrayRef = ArrayOrError.GetValue();
+		const int32 Num = ArrayRef.Num();
+		return MakeValue(TArrayView<T>(Num > 0 ? reinterpret_cast<T*>(ArrayRef.GetRawPtr(0)) : nullptr, Num));
+	}
+
+	/**
+	 * Bulk setter for array properties: resizes once and copies all elements with a single memcpy.
+	 * Adds the array property if it is missing. Only for trivially copyable element types.
+	 */
+	template <typename T>
+	void SetArray(FInstancedPropertyBag& Bag, const FName& Name, TConstArrayView<T> Values)
+	{
+		static_assert(Private::TIsViewableArrayElement<T>, "Bulk array copies are only available for trivially copyable element types.");
+
+		Private::EnsureArrayProperty(Bag, Name, TPropertyBagType<T>::Type, TPropertyBagType<T>::GetObjectType());
+
+		TValueOrError<FPropertyBagArrayRef, EPropertyBagResult> ArrayOrError = Bag.GetMutableArrayRef(Name);
+		if (ArrayOrError.HasValue())
+		{
+			FPropertyBagArrayRef& ArrayRef = ArrayOrError.GetValue();
+			ArrayRef.EmptyAndAddUninitializedValues(Values.Num());
+			if (Values.Num() > 0)
+			{
+				FMemory::Memcpy(ArrayRef.GetRawPtr(0), Values.GetData(), Values.Num() * sizeof(T));
+			}
+		}
+	}
+
 } // End namespace ScriptablePropertyBag
\ No newline at end of file
@@ -0,0 +1,46 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/PropertyBag.h"
+#include "UObject/GCObject.h"
+
+/**
+ * Recycles the value memory of runtime Context bags, keyed by bag layout.
+ * Copying an FInstancedPropertyBag always frees and reallocates its value memory, so runtime copies
+ * take a released bag of the same layout instead and copy the values in place.
+ * Pooled bags are reset to their default values and keep their layout alive. Game thread only.
+ */
+class SCRIPTABLEFRAMEWORK_API FScriptableContextBagPool : public FGCObject
+{
+public:
+	/** Makes Target a copy of Source, reusing Target's memory or a pooled bag of the same layout when possible. */
+	static void CopyFrom(FInstancedPropertyBag& Target, const FInstancedPropertyBag& Source);
+
+	/** Moves the bag's memory into the pool (or frees it if the pool is full) and leaves the bag empty. */
+	static void Release(FInstancedPropertyBag& Bag);
+
+	/** Frees all pooled memory. */
+	static void Trim();
+
+	/** Number of pooled bags, all layouts included. */
+	static int32 GetNumPooled();
+
+	/** Called by the module. */
+	static void Startup();
+	static void Shutdown();
+
+	//~ FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FScriptableContextBagPool"); }
+
+private:
+	static FScriptableContextBagPool* Get();
+
+	/** Takes a pooled bag of the given layout. Returns false if there is none. */
+	bool Pop(const UPropertyBag* Layout, FInstancedPropertyBag& OutBag);
+
+	TMap<const UPropertyBag*, TArray<FInstancedPropertyBag>> FreeBags;
+	int32 NumPooled = 0;
+};
@@ -0,0 +1,72 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/PropertyBagHelpers.h"
+
+/**
+ * Declares a Context layout in one go.
+ * Adding properties to a bag one at a time creates a new bag struct and migrates the values on every call.
+ * The builder collects all declarations first, creates the layout once (cached for the builder's lifetime)
+ * and then writes the initial values.
+ *
+ * Usage:
+ *   static const FScriptableContextBuilder Schema = FScriptableContextBuilder()
+ *       .Add<AActor*>(TEXT("Target"))
+ *       .Add<float>(TEXT("Damage"), 10.f);
+ *   Schema.Apply(Action.GetContext());
+ */
+class SCRIPTABLEFRAMEWORK_API FScriptableContextBuilder
+{
+public:
+	/** Declares a property initialized to its default value. */
+	template <typename T>
+	FScriptableContextBuilder& Add(const FName& Name)
+	{
+		using FTraits = ScriptablePropertyBag::TPropertyBagType<T>;
+		AddDesc(Name, EPropertyBagContainerType::None, FTraits::Type, FTraits::GetObjectType());
+		return *this;
+	}
+
+	/** Declares a property and its initial value. */
+	template <typename T>
+	FScriptableContextBuilder& Add(const FName& Name, const T& Value)
+	{
+		Add<T>(Name);
+		ValueSetters.Emplace([Name, Value](FInstancedPropertyBag& Bag)
+		{
+			ScriptablePropertyBag::Set(Bag, Name, Value);
+		});
+		return *this;
+	}
+
+	/** Declares an untyped (possibly container) property, e.g. from an FScriptableParameterDef. */
+	FScriptableContextBuilder& AddContainer(const FName& Name, EPropertyBagContainerType ContainerType, EPropertyBagPropertyType ValueType, const UObject* ValueTypeObject = nullptr)
+	{
+		AddDesc(Name, ContainerType, ValueType, ValueTypeObject);
+		return *this;
+	}
+
+	int32 Num() const { return Descs.Num(); }
+
+	/** Returns the bag struct for the declared layout, created on first use. */
+	const UPropertyBag* GetBagStruct() const;
+
+	/**
+	 * Adds the declared properties to the bag with a single layout change, then writes the initial values.
+	 * An empty bag takes the cached layout directly.
+	 */
+	void Apply(FInstancedPropertyBag& Bag) const;
+
+	/** Returns a new bag with the declared layout and initial values. */
+	FInstancedPropertyBag Build() const;
+
+private:
+	void AddDesc(const FName& Name, EPropertyBagContainerType ContainerType, EPropertyBagPropertyType ValueType, const UObject* ValueTypeObject);
+
+	TArray<FPropertyBagPropertyDesc> Descs;
+	TArray<TFunction<void(FInstancedPropertyBag&)>> ValueSetters;
+
+	mutable TWeakObjectPtr<const UPropertyBag> CachedBagStruct;
+};
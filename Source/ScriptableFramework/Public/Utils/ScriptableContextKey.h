@@ -0,0 +1,131 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/PropertyBagHelpers.h"
+#include "UObject/EnumProperty.h"
+
+/**
+ * Typed handle to a Context property.
+ * Resolves the name to the bag's property once and then reads and writes its memory directly,
+ * instead of doing a name lookup (and an AddProperty for writes) on every access.
+ * The cached property is revalidated against the bag's layout, so a key can be shared between bags
+ * but is fastest when used repeatedly with bags of the same layout. Not thread safe.
+ *
+ * Usage:
+ *   static const TScriptableContextKey<float> HealthKey(TEXT("Health"));
+ *   HealthKey.Set(Action.GetContext(), 100.f);
+ *
+ * Object keys use the pointer type (e.g. TScriptableContextKey<AActor*>).
+ */
+template<typename T>
+class TScriptableContextKey
+{
+	using FTraits = ScriptablePropertyBag::TPropertyBagType<T>;
+
+	static constexpr bool bIsObject = std::is_pointer_v<T>;
+	static constexpr bool bIsEnum = TIsEnum<T>::Value;
+
+public:
+	TScriptableContextKey() = default;
+	explicit TScriptableContextKey(const FName& InName) : Name(InName) {}
+
+	const FName& GetName() const { return Name; }
+
+	/**
+	 * Resolves the key against the bag's current layout.
+	 * @return False if the bag doesn't declare the property, or declares it with another type.
+	 */
+	bool Resolve(const FInstancedPropertyBag& Bag) const
+	{
+		const UPropertyBag* BagStruct = Bag.GetPropertyBagStruct();
+		if (CachedBagStruct == BagStruct && BagStruct)
+		{
+			return CachedProperty != nullptr;
+		}
+
+		CachedBagStruct = BagStruct;
+		CachedProperty = nullptr;
+
+		if (const FPropertyBagPropertyDesc* Desc = BagStruct ? BagStruct->FindPropertyDescByName(Name) : nullptr)
+		{
+			if (Desc->ValueType == FTraits::Type && Desc->ValueTypeObject == FTraits::GetObjectType() && Desc->ContainerTypes.Num() == 0)
+			{
+				CachedProperty = Desc->CachedProperty;
+			}
+		}
+
+		return CachedProperty != nullptr;
+	}
+
+	/** Reads the value, or returns a default value if the bag doesn't declare the property. */
+	T Get(const FInstancedPropertyBag& Bag) const
+	{
+		if (!Resolve(Bag))
+		{
+			return T();
+		}
+
+		const void* ValuePtr = CachedProperty->ContainerPtrToValuePtr<void>(Bag.GetValue().GetMemory());
+
+		if constexpr (bIsObject)
+		{
+			return Cast<std::remove_pointer_t<T>>(CastFieldChecked<FObjectPropertyBase>(CachedProperty)->GetObjectPropertyValue(ValuePtr));
+		}
+		else if constexpr (bIsEnum)
+		{
+			return static_cast<T>(CastFieldChecked<FEnumProperty>(CachedProperty)->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+		}
+		else
+		{
+			return *static_cast<const T*>(ValuePtr);
+		}
+	}
+
+	/** Returns a pointer to the value inside the bag, or nullptr. Not available for object and enum keys. */
+	const T* GetPtr(const FInstancedPropertyBag& Bag) const
+	{
+		static_assert(!bIsObject && !bIsEnum, "Use Get() for object and enum keys.");
+		return Resolve(Bag) ? CachedProperty->ContainerPtrToValuePtr<T>(Bag.GetValue().GetMemory()) : nullptr;
+	}
+
+	/** Returns a mutable pointer to the value inside the bag, or nullptr. Not available for object and enum keys. */
+	T* GetMutablePtr(FInstancedPropertyBag& Bag) const
+	{
+		static_assert(!bIsObject && !bIsEnum, "Use Set() for object and enum keys.");
+		return Resolve(Bag) ? CachedProperty->ContainerPtrToValuePtr<T>(Bag.GetMutableValue().GetMemory()) : nullptr;
+	}
+
+	/** Writes the value. If the bag doesn't declare the property yet it is added first (slow path, changes the layout). */
+	void Set(FInstancedPropertyBag& Bag, const T& Value) const
+	{
+		if (!Resolve(Bag))
+		{
+			ScriptablePropertyBag::Set(Bag, Name, Value);
+			return;
+		}
+
+		void* ValuePtr = CachedProperty->ContainerPtrToValuePtr<void>(Bag.GetMutableValue().GetMemory());
+
+		if constexpr (bIsObject)
+		{
+			CastFieldChecked<FObjectPropertyBase>(CachedProperty)->SetObjectPropertyValue(ValuePtr, Value);
+		}
+		else if constexpr (bIsEnum)
+		{
+			CastFieldChecked<FEnumProperty>(CachedProperty)->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value));
+		}
+		else
+		{
+			*static_cast<T*>(ValuePtr) = Value;
+		}
+	}
+
+private:
+	FName Name;
+
+	/** Layout the cached property belongs to. Weak, so a recycled address is not mistaken for the same layout. */
+	mutable TWeakObjectPtr<const UPropertyBag> CachedBagStruct;
+	mutable const FProperty* CachedProperty = nullptr;
+};
@@ -22,5 +22,11 @@ public class ScriptableFramework : ModuleRules
 				"Slate",
 				"SlateCore"
 			});
+
+		if (Target.bBuildEditor)
+		{
+			// Cook-time build configuration, see UScriptableObject::NeedsLoadForTargetPlatform.
+			PrivateDependencyModuleNames.Add("DeveloperToolSettings");
+		}
 	}
 }
\ No newline at end of file
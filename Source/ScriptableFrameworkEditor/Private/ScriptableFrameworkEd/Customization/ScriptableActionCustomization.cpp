@@ -33,6 +33,20 @@ FText FScriptableActionCustomization::GetAddButtonTooltip() const
 	return LOCTEXT("AddTaskTooltip", "Add new Task.");
 }
 
+FName FScriptableActionCustomization::GetNodeListPropertyName() const
+{
+	return GET_MEMBER_NAME_CHECKED(FScriptableAction, TaskNodes);
+}
+
+void FScriptableActionCustomization::GetExtraPropertyNames(TArray<FName>& OutNames) const
+{
+	OutNames.Add(GET_MEMBER_NAME_CHECKED(FScriptableAction, bLazyTaskRegistration));
+	OutNames.Add(GET_MEMBER_NAME_CHECKED(FScriptableAction, bTimeSliced));
+	OutNames.Add(GET_MEMBER_NAME_CHECKED(FScriptableAction, SchedulePriority));
+	OutNames.Add(GET_MEMBER_NAME_CHECKED(FScriptableAction, StartupFrameSpread));
+	OutNames.Add(GET_MEMBER_NAME_CHECKED(FScriptableAction, MaxTaskStartsPerFrame));
+}
+
 UClass* FScriptableActionCustomization::GetWrapperClass() const
 {
 	return UScriptableTask_RunAsset::StaticClass();
@@ -16,6 +16,8 @@ protected:
 	virtual FName GetModePropertyName() const override;
 	virtual FSlateColor GetIconColor() const override;
 	virtual FText GetAddButtonTooltip() const override;
+	virtual FName GetNodeListPropertyName() const override;
+	virtual void GetExtraPropertyNames(TArray<FName>& OutNames) const override;
 
 	virtual UClass* GetWrapperClass() const override;
 
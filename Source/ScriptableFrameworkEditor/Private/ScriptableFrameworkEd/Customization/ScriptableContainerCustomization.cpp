@@ -130,6 +130,27 @@ void FScriptableContainerCustomization::CustomizeChildren(TSharedRef<IPropertyHa
 	ArrayBuilder->OnGenerateArrayElementWidget(FOnGenerateArrayElementWidget::CreateSP(this, &FScriptableContainerCustomization::OnGenerateElement));
 
 	ChildBuilder.AddCustomBuilder(ArrayBuilder);
+
+	const FName NodeListPropertyName = GetNodeListPropertyName();
+	if (!NodeListPropertyName.IsNone())
+	{
+		if (TSharedPtr<IPropertyHandle> NodeListHandle = StructHandle->GetChildHandle(NodeListPropertyName))
+		{
+			ChildBuilder.AddProperty(NodeListHandle.ToSharedRef());
+		}
+	}
+
+	TArray<FName> ExtraPropertyNames;
+	GetExtraPropertyNames(ExtraPropertyNames);
+
+	for (const FName& ExtraPropertyName : ExtraPropertyNames)
+	{
+		TSharedPtr<IPropertyHandle> ExtraHandle = StructHandle->GetChildHandle(ExtraPropertyName);
+		if (ExtraHandle.IsValid())
+		{
+			ChildBuilder.AddProperty(ExtraHandle.ToSharedRef()).IsAdvanced(true);
+		}
+	}
 }
 
 void FScriptableContainerCustomization::OnGenerateElement(TSharedRef<IPropertyHandle> ElementHandle, int32 Index, IDetailChildrenBuilder& Builder)
@@ -43,6 +43,12 @@ protected:
 	/** Tooltip for the Add button. */
 	virtual FText GetAddButtonTooltip() const = 0;
 
+	/** The name of the struct node array property (e.g. "TaskNodes"), displayed right below the list. */
+	virtual FName GetNodeListPropertyName() const { return NAME_None; }
+
+	/** Additional container properties displayed below the list (e.g. scheduling options). */
+	virtual void GetExtraPropertyNames(TArray<FName>& OutNames) const {}
+
 	// --- Wrapper Configuration ---
 
 	/** Returns the class of the wrapper task/condition (e.g. UScriptableTask_RunAsset). */
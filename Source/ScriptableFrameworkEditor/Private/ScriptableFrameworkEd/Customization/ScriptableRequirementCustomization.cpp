@@ -65,6 +65,11 @@ FText FScriptableRequirementCustomization::GetAddButtonTooltip() const
 	return LOCTEXT("AddConditionTooltip", "Add new Condition.");
 }
 
+FName FScriptableRequirementCustomization::GetNodeListPropertyName() const
+{
+	return GET_MEMBER_NAME_CHECKED(FScriptableRequirement, ConditionNodes);
+}
+
 UClass* FScriptableRequirementCustomization::GetWrapperClass() const
 {
 	return UScriptableCondition_Asset::StaticClass();
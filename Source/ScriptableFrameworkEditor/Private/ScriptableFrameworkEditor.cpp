@@ -10,10 +10,12 @@
 #include "ScriptableTasks/ScriptableTask.h"
 #include "ScriptableTasks/ScriptableActionAsset.h"
 #include "ScriptableTasks/ScriptableAction.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
 
 #include "ScriptableConditions/ScriptableCondition.h"
 #include "ScriptableConditions/ScriptableRequirementAsset.h"
 #include "ScriptableConditions/ScriptableRequirement.h"
+#include "ScriptableConditions/ScriptableConditionNode.h"
 
 #include "ScriptableFrameworkEd/Customization/ScriptableTaskCustomization.h"
 #include "ScriptableFrameworkEd/Customization/ScriptableActionCustomization.h"
@@ -57,6 +59,8 @@ TSharedPtr<FScriptableTypeCache> FScriptableFrameworkEditorModule::GetScriptable
 		ScriptableTypeCache = MakeShareable(new FScriptableTypeCache());
 		ScriptableTypeCache->AddRootClass(UScriptableTask::StaticClass());
 		ScriptableTypeCache->AddRootClass(UScriptableCondition::StaticClass());
+		ScriptableTypeCache->AddRootScriptStruct(FScriptableTaskNode::StaticStruct());
+		ScriptableTypeCache->AddRootScriptStruct(FScriptableConditionNode::StaticStruct());
 	}
 
 	return ScriptableTypeCache;
@@ -269,11 +269,15 @@ namespace ScriptableFrameworkEditor
 				const FScriptableContainer* Container = static_cast<const FScriptableContainer*>(StructData);
 
 				// Only consider this context if it actually has properties defined.
-				if (Container->HasContext() && Container->Context.GetNumPropertiesInBag() > 0)
+				// A fixed struct Context is the container's declared signature, so it is shown instead of the bag.
+				const UStruct* ContextStruct = Container->ContextStruct.IsValid() ? static_cast<const UStruct*>(Container->ContextStruct.GetScriptStruct())
+					: (Container->Context.GetNumPropertiesInBag() > 0 ? Container->Context.GetPropertyBagStruct() : nullptr);
+
+				if (ContextStruct)
 				{
 					FPropertyBindingBindableStructDescriptor& ContextDesc = OutStructDescs.AddDefaulted_GetRef();
 					ContextDesc.Name = FName(TEXT("Context")); // Always named "Context" as it's the only one visible
-					ContextDesc.Struct = Container->Context.GetPropertyBagStruct();
+					ContextDesc.Struct = ContextStruct;
 					ContextDesc.ID = FGuid();
 
 					bFoundContext = true;
@@ -318,6 +322,14 @@ namespace ScriptableFrameworkEditor
 		// 4. Convert to Output
 		for (const UScriptableObject* Obj : AccessibleObjects)
 		{
+			// Shared condition templates are one object for every instance (and may be deduplicated at load),
+			// so they are never binding sources at runtime and can't be offered as one.
+			const UScriptableCondition* Condition = Cast<UScriptableCondition>(Obj);
+			if (Condition && Condition->IsSharedTemplate())
+			{
+				continue;
+			}
+
 			if (Obj->GetBindingID().IsValid())
 			{
 				FPropertyBindingBindableStructDescriptor& Desc = OutStructDescs.AddDefaulted_GetRef();
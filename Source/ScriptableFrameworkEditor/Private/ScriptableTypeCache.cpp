@@ -13,6 +13,8 @@
 #include "Logging/MessageLog.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Misc/EnumerateRange.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
+#include "ScriptableConditions/ScriptableConditionNode.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ScriptableTypeCache)
 
@@ -82,16 +84,26 @@ UStruct* FScriptableTypeData::GetStruct(bool bSilent)
 
 const UStruct* FScriptableTypeData::GetInstanceDataStruct(bool bSilent /*= false*/)
 {
-	/*if (!InstanceDataStruct.IsValid())
+	if (!InstanceDataStruct.IsValid())
 	{
 		if (const UScriptStruct* ScriptStruct = GetScriptStruct(bSilent))
 		{
-			TInstancedStruct<FStateTreeNodeBase> NodeInstance;
-			NodeInstance.InitializeAsScriptStruct(ScriptStruct);
+			if (ScriptStruct->IsChildOf(FScriptableTaskNode::StaticStruct()))
+			{
+				TInstancedStruct<FScriptableTaskNode> NodeInstance;
+				NodeInstance.InitializeAsScriptStruct(ScriptStruct);
+
+				InstanceDataStruct = NodeInstance.Get().GetInstanceDataType();
+			}
+			else if (ScriptStruct->IsChildOf(FScriptableConditionNode::StaticStruct()))
+			{
+				TInstancedStruct<FScriptableConditionNode> NodeInstance;
+				NodeInstance.InitializeAsScriptStruct(ScriptStruct);
 
-			InstanceDataStruct = NodeInstance.Get().GetInstanceDataType();
+				InstanceDataStruct = NodeInstance.Get().GetInstanceDataType();
+			}
 		}
-	}*/
+	}
 
 	return InstanceDataStruct.Get();
 }